@@ -218,6 +218,56 @@ namespace iris {
 			}
 		}
 
+		// walk the view chain and yield every contiguous (ptr, len) segment without
+		// copying, e.g. to fill an iovec array for writev/io_uring submission.
+		// flat buffers yield a single segment, empty segments are skipped.
+		template <typename operation_t>
+		void for_each_segment(operation_t&& op) const {
+			if (is_view_storage()) {
+				const iris_buffer_t* p = this;
+				while (p != nullptr) {
+					size_t n = p->get_size();
+					if (n != 0) {
+						op(p->get_data(), n);
+					}
+
+					p = p->next;
+				}
+			} else {
+				size_t n = get_size();
+				if (n != 0) {
+					op(get_data(), n);
+				}
+			}
+		}
+
+		template <typename operation_t>
+		void for_each_segment(operation_t&& op) {
+			if (is_view_storage()) {
+				iris_buffer_t* p = this;
+				while (p != nullptr) {
+					size_t n = p->get_size();
+					if (n != 0) {
+						op(p->get_data(), n);
+					}
+
+					p = p->next;
+				}
+			} else {
+				size_t n = get_size();
+				if (n != 0) {
+					op(get_data(), n);
+				}
+			}
+		}
+
+		// count of segments for_each_segment would yield, for sizing iovec arrays
+		size_t get_segment_count() const noexcept {
+			size_t count = 0;
+			for_each_segment([&count](const element_t*, size_t) noexcept { count++; });
+			return count;
+		}
+
 		// copy data from continous region (`ptr`, `size`) to this buffer starting at `offset` with `repeat` count
 		void copy(size_t offset, const element_t* ptr, size_t size, size_t repeat = 1) noexcept {
 			if (is_view_storage()) { // parted? copy by segments
@@ -244,10 +294,46 @@ namespace iris {
 			} else {
 				// continous, go plain copy
 				element_t* p = get_data();
-				while (repeat-- != 0) {
+				if (repeat != 0 && size != 0) {
 					std::memcpy(p + offset, ptr, size * sizeof(element_t));
-					offset += size;
+
+					// repeat by doubling the already-written run: one memcpy per
+					// power of two instead of one per repetition, each call on the
+					// longest possible run so the simd-dispatched memcpy shines
+					size_t written = size;
+					size_t total = size * repeat;
+					while (written < total) {
+						size_t run = std::min(written, total - written);
+						std::memcpy(p + offset + written, p + offset, run * sizeof(element_t));
+						written += run;
+					}
+				}
+			}
+		}
+
+		// fill `count` elements starting at `offset` with a repeated element,
+		// using memset for byte-sized types and doubling runs otherwise.
+		// works across view segments.
+		void fill(size_t offset, const element_t& element, size_t count) noexcept {
+			if (is_view_storage()) {
+				IRIS_ASSERT(offset + count <= get_view_size());
+				iris_buffer_t* p = this;
+				while (p != nullptr && count != 0) {
+					size_t len = p->get_size();
+					if (offset < len) {
+						size_t r = std::min(len - offset, count);
+						fill_flat(p->get_data() + offset, element, r);
+						count -= r;
+						offset = 0;
+					} else {
+						offset -= len;
+					}
+
+					p = p->next;
 				}
+			} else {
+				IRIS_ASSERT(offset + count <= get_size());
+				fill_flat(get_data() + offset, element, count);
 			}
 		}
 
@@ -470,6 +556,20 @@ namespace iris {
 			resize(get_size() - 1);
 		}
 
+		// collapse a view chain into a contiguous managed buffer, for consumers
+		// that need flat data after rope-style appending. flat buffers and
+		// single-segment views are left untouched.
+		void linearize() {
+			if (!is_view_storage() || next == nullptr) {
+				return;
+			}
+
+			iris_buffer_t flat;
+			flat.resize(get_view_size());
+			flat.copy(0, *this);
+			*this = std::move(flat);
+		}
+
 		// plain data assignment
 		iris_buffer_t& assign(const element_t* buffer, size_t n) noexcept(noexcept(std::declval<iris_buffer_t>().resize(n))) {
 			resize(n);
@@ -481,6 +581,30 @@ namespace iris {
 		}
 
 	protected:
+		static void fill_flat(element_t* data, const element_t& element, size_t count) noexcept {
+			if (count != 0) {
+				fill_flat_impl(data, element, count, std::integral_constant<bool, sizeof(element_t) == 1>());
+			}
+		}
+
+		static void fill_flat_impl(element_t* data, const element_t& element, size_t count, std::true_type) noexcept {
+			uint8_t value;
+			std::memcpy(&value, &element, 1);
+			std::memset(data, value, count);
+		}
+
+		static void fill_flat_impl(element_t* data, const element_t& element, size_t count, std::false_type) noexcept {
+			data[0] = element;
+
+			// double the already-written run, one memcpy per power of two
+			size_t written = 1;
+			while (written < count) {
+				size_t run = std::min(written, count - written);
+				std::memcpy(data + written, data, run * sizeof(element_t));
+				written += run;
+			}
+		}
+
 		// plain data copying
 		void copy(const iris_buffer_t& rhs) noexcept(noexcept(std::declval<iris_buffer_t>().resize(rhs.get_size()))) {
 			if (rhs.is_view_storage()) {
@@ -506,6 +630,119 @@ namespace iris {
 
 	using iris_bytes_t = iris_buffer_t<uint8_t>;
 
+	// frozen key-value store for hot config/asset metadata: built once from
+	// sorted iris_key_value_t pairs into a single contiguous blob (header plus
+	// packed pair array, keys inline), looked up with a branch-light
+	// lower-bound, and trivially serializable — attach() binds a read-only
+	// view over mapped bytes with no construction pass. compared to a node
+	// based hash map this halves memory and removes the pointer chasing.
+	template <typename key_t, typename value_t>
+	struct iris_frozen_map_t {
+		static_assert(std::is_trivially_copy_constructible<key_t>::value && std::is_trivially_destructible<key_t>::value, "key_t must be trivially copyable to freeze!");
+		static_assert(std::is_trivially_copy_constructible<value_t>::value && std::is_trivially_destructible<value_t>::value, "value_t must be trivially copyable to freeze!");
+
+		using pair_t = iris_key_value_t<key_t, value_t>;
+		static constexpr uint32_t map_magic = 0x4d524953u; // 'SIRM'
+		static constexpr uint32_t map_version = 1;
+
+		struct header_t {
+			uint32_t magic;
+			uint32_t version;
+			uint64_t count;
+		};
+
+		iris_frozen_map_t() noexcept : pairs(nullptr), count(0) {}
+
+		// serialize sorted unique pairs into a flat blob appended to out
+		static void freeze(const pair_t* source, size_t pair_count, std::vector<uint8_t>& out) {
+#if IRIS_DEBUG
+			for (size_t i = 1; i < pair_count; i++) {
+				IRIS_ASSERT(source[i - 1].first < source[i].first);
+			}
+#endif
+
+			header_t header;
+			header.magic = map_magic;
+			header.version = map_version;
+			header.count = pair_count;
+
+			size_t offset = out.size();
+			out.resize(offset + sizeof(header_t) + pair_count * sizeof(pair_t));
+			std::memcpy(&out[offset], &header, sizeof(header_t));
+			if (pair_count != 0) {
+				std::memcpy(&out[offset + sizeof(header_t)], source, pair_count * sizeof(pair_t));
+			}
+		}
+
+		// convenience: sort a copy of arbitrary pairs and freeze them
+		static void build(std::vector<pair_t> source, std::vector<uint8_t>& out) {
+			std::sort(source.begin(), source.end());
+			freeze(source.empty() ? nullptr : &source[0], source.size(), out);
+		}
+
+		// bind a read-only view over a blob or mapping, returns false when malformed
+		bool attach(const void* data, size_t size) noexcept {
+			pairs = nullptr;
+			count = 0;
+
+			if (data == nullptr || size < sizeof(header_t)) {
+				return false;
+			}
+
+			header_t header;
+			std::memcpy(&header, data, sizeof(header_t));
+			if (header.magic != map_magic || header.version != map_version) {
+				return false;
+			}
+
+			// divide instead of multiplying so a hostile count cannot wrap the bound
+			if (header.count > (size - sizeof(header_t)) / sizeof(pair_t)) {
+				return false;
+			}
+
+			pairs = reinterpret_cast<const pair_t*>(reinterpret_cast<const uint8_t*>(data) + sizeof(header_t));
+			count = iris_verify_cast<size_t>(header.count);
+			return true;
+		}
+
+		// branch-light lookup, nullptr when absent
+		const value_t* find(const key_t& key) const noexcept {
+			size_t n = count;
+			if (n == 0) {
+				return nullptr;
+			}
+
+			const pair_t* base = pairs;
+			while (n > 1) {
+				size_t half = n / 2;
+				base += base[half - 1].first < key ? half : 0; // cmov-friendly
+				n -= half;
+			}
+
+			return !(base->first < key) && !(key < base->first) ? &base->second : nullptr;
+		}
+
+		size_t size() const noexcept {
+			return count;
+		}
+
+		bool empty() const noexcept {
+			return count == 0;
+		}
+
+		const pair_t* begin() const noexcept {
+			return pairs;
+		}
+
+		const pair_t* end() const noexcept {
+			return pairs + count;
+		}
+
+	protected:
+		const pair_t* pairs;
+		size_t count;
+	};
+
 	template <typename element_t, size_t block_size = default_block_size, template <typename...> class base_allocator_t = iris_default_block_allocator_t>
 	struct iris_cache_t : protected iris_queue_list_t<element_t, base_allocator_t, false> {
 		using storage_t = iris_queue_list_t<element_t, base_allocator_t, false>;
@@ -531,7 +768,7 @@ namespace iris {
 					size_t alloc_count = std::min(size, pack);
 					slice = allocate_linear(alloc_count + head_count, alignment).first;
 					iris_buffer_t<element_t>* next = new (slice) iris_buffer_t<element_t>();
-					*next = iris_buffer_t<element_t>::make_view(slice + head_count, pack);
+					*next = iris_buffer_t<element_t>::make_view(slice + head_count, alloc_count);
 					size -= alloc_count;
 
 					p->append(*next);
@@ -548,6 +785,18 @@ namespace iris {
 			return storage_t::full_pack_size();
 		}
 
+		// rope-style append: grow a (possibly chained) buffer by linking a new
+		// cache-allocated segment instead of reallocating and copying the whole
+		// payload, so building large serialized blobs is O(n) total. consumers
+		// that need contiguity call linearize() on the result once.
+		void append(iris_buffer_t<element_t>& rope, const element_t* data, size_t count) {
+			if (count != 0) {
+				iris_buffer_t<element_t> segment = allocate(count);
+				segment.copy(0, data, count);
+				link(rope, segment);
+			}
+		}
+
 		void link(iris_buffer_t<element_t>& from, const iris_buffer_t<element_t>& to) {
 			if (from.empty()) {
 				from = to;
@@ -566,6 +815,104 @@ namespace iris {
 			storage_t::reset(0);
 		}
 
+		// clear the cache but retain slabs covering up to capacity_hint elements
+		// for the next frame, so steady per-frame usage stops hitting the root
+		// allocator entirely
+		void clear_keep(size_t capacity_hint) noexcept {
+			storage_t::reset(capacity_hint);
+		}
+
+		// release spare slabs beyond target_capacity elements, reclaiming the
+		// high-water mark; call with decreasing targets to trim gradually
+		void trim(size_t target_capacity) noexcept {
+			typename storage_t::node_t* p = storage_t::pop_head;
+			size_t capacity = storage_t::element_count; // push_head itself
+			while (p != storage_t::push_head) {
+				capacity += storage_t::element_count;
+				p = p->next;
+			}
+
+			// nodes beyond push_head are spare, keep only enough for the target
+			typename storage_t::node_t* q = storage_t::push_head;
+			while (q->next != nullptr) {
+				if (capacity + storage_t::element_count > target_capacity) {
+					typename storage_t::node_t* t = q->next;
+					q->next = nullptr;
+
+					while (t != nullptr) {
+						typename storage_t::node_t* next = t->next;
+						t->~node_t();
+						storage_t::node_allocator_t::deallocate(t, 1);
+						t = next;
+					}
+
+					break;
+				}
+
+				capacity += storage_t::element_count;
+				q = q->next;
+			}
+		}
+
+		// walk all stored runs as (ptr, count) segments, e.g. for serialization
+		// or comparing snapshots
+		template <typename operation_t>
+		void for_each_data(operation_t&& op) const {
+			for (const typename storage_t::node_t* p = storage_t::pop_head; p != nullptr; p = (p == storage_t::push_head ? nullptr : p->next)) {
+				p->for_each(op);
+			}
+		}
+
+		// block-level clone for trivially copyable element types: this cache's
+		// node chain is rebuilt from rhs with one memcpy per node run,
+		// preserving the per-node layout (including alignment holes), so a
+		// frame-state snapshot costs O(bytes) instead of element-wise container
+		// copies. note that pointers into the source cache are not fixed up;
+		// consumers must address the snapshot by offsets or rebuild views.
+		template <typename type_t = element_t>
+		typename std::enable_if<std::is_trivially_copyable<type_t>::value>::type clone_from(const iris_cache_t& rhs) {
+			storage_t::reset(0);
+
+			typename storage_t::node_t* target = storage_t::pop_head;
+			const typename storage_t::node_t* source = rhs.pop_head;
+			target->reset(source->begin_index());
+
+			while (true) {
+				source->for_each([target](const element_t* data, size_t count) {
+					size_t pushed = target->push_n(data, count);
+					IRIS_ASSERT(pushed == count);
+				});
+
+				if (source == rhs.push_head) {
+					break;
+				}
+
+				source = source->next;
+
+				typename storage_t::node_t* p = storage_t::node_allocator_t::allocate(1);
+				new (p) typename storage_t::node_t(static_cast<typename storage_t::node_allocator_t&>(*this), source->begin_index());
+				target->next = p;
+				storage_t::push_head = p;
+				target = p;
+			}
+
+			storage_t::iterator_counter = rhs.iterator_counter;
+		}
+
+		iris_memory_stats_t get_memory_stats() const noexcept {
+			return storage_t::get_memory_stats();
+		}
+
+		// count of slabs currently owned (in use plus spare)
+		size_t get_node_count() const noexcept {
+			size_t count = 0;
+			for (const typename storage_t::node_t* p = storage_t::pop_head; p != nullptr; p = p->next) {
+				count++;
+			}
+
+			return count;
+		}
+
 		// allocate continuous array from queue_list
 		// may lead holes in low-level storage if current node is not enough
 		std::pair<element_t*, size_t> allocate_linear(size_t count, size_t alignment) {
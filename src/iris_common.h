@@ -86,6 +86,13 @@ SOFTWARE.
 #define IRIS_ASSERT assert
 #endif
 
+// define IRIS_ENABLE_MEMORY_STATS to track live allocation counts inside
+// iris_allocator_t (one relaxed atomic per allocate/deallocate); structural
+// counters on the root allocator and containers are always available.
+#ifndef IRIS_ENABLE_MEMORY_STATS
+#define IRIS_ENABLE_MEMORY_STATS 0
+#endif
+
 #ifndef IRIS_LOGERROR
 #define IRIS_LOGERROR(...) fprintf(stderr, __VA_ARGS__)
 #endif
@@ -524,6 +531,30 @@ namespace iris {
 		}
 	}
 
+	// hint the prefetcher to pull the given address into cache
+	inline void iris_prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#else
+		(void)address;
+#endif
+	}
+
+	// emit a cpu-level pause hint for spin-wait loops
+	inline void iris_thread_pause() noexcept {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		__asm__ __volatile__("yield");
+#else
+		std::this_thread::yield();
+#endif
+	}
+
 	template <typename type_t, typename index_t>
 	void iris_union_set_init(type_t&& vec, index_t from, index_t to) {
 		while (from != to) {
@@ -555,9 +586,34 @@ namespace iris {
 		vec[iris_union_set_find(vec, to)] = iris_union_set_find(vec, from);
 	}
 
+	// memory introspection snapshot, see get_memory_stats() on the allocators
+	// and containers. aggregate per subsystem by summing the snapshots.
+	struct iris_memory_stats_t {
+		size_t bytes_reserved = 0; // memory held from the system
+		size_t bytes_in_use = 0; // live payload bytes (when tracked)
+		size_t block_count = 0;
+		size_t high_water_bytes = 0; // peak reservation observed
+
+		iris_memory_stats_t& operator += (const iris_memory_stats_t& rhs) noexcept {
+			bytes_reserved += rhs.bytes_reserved;
+			bytes_in_use += rhs.bytes_in_use;
+			block_count += rhs.block_count;
+			high_water_bytes += rhs.high_water_bytes;
+			return *this;
+		}
+	};
+
 	extern IRIS_SHARED_LIBRARY_DECORATOR void* iris_alloc_aligned(size_t size, size_t alignment);
 	extern IRIS_SHARED_LIBRARY_DECORATOR void iris_free_aligned(void* data, size_t size) noexcept;
 
+	// opt-in 2MB huge-page backing for large allocations (huge-page multiples),
+	// with transparent fallback to normal pages when the system refuses. since
+	// iris_root_allocator_t requests its block arrays through iris_alloc_aligned,
+	// all block allocators layered on it benefit automatically.
+	// the compile-time default can be set via IRIS_USE_HUGE_PAGES.
+	extern IRIS_SHARED_LIBRARY_DECORATOR void iris_set_huge_pages_enabled(bool enabled) noexcept;
+	extern IRIS_SHARED_LIBRARY_DECORATOR bool iris_get_huge_pages_enabled() noexcept;
+
 	// global allocator that allocates memory blocks to local allocators.
 	template <size_t alloc_size, size_t total_count>
 	struct iris_root_allocator_t {
@@ -598,11 +654,26 @@ namespace iris {
 			do {
 				std::lock_guard<std::mutex> guard(lock);
 				blocks.emplace_back(block);
+
+				size_t count = blocks.size();
+				stat_block_count.store(count, std::memory_order_relaxed);
+				size_t high_water = stat_high_water.load(std::memory_order_relaxed);
+				while (count > high_water && !stat_high_water.compare_exchange_weak(high_water, count, std::memory_order_relaxed)) {}
 			} while (false);
 
 			return block.address;
 		}
 
+		// lock-free memory snapshot of this root allocator
+		iris_memory_stats_t get_memory_stats() const noexcept {
+			iris_memory_stats_t stats;
+			stats.block_count = stat_block_count.load(std::memory_order_relaxed);
+			stats.bytes_reserved = stats.block_count * alloc_size * total_count;
+			stats.bytes_in_use = stats.bytes_reserved; // per-slot usage lives in the local allocators
+			stats.high_water_bytes = stat_high_water.load(std::memory_order_relaxed) * alloc_size * total_count;
+			return stats;
+		}
+
 		void deallocate(void* p) {
 			void* t = nullptr;
 
@@ -630,6 +701,7 @@ namespace iris {
 							if (n == bitmap_count) {
 								t = block.address;
 								blocks.erase(blocks.begin() + i);
+								stat_block_count.store(blocks.size(), std::memory_order_relaxed);
 							}
 						}
 
@@ -657,6 +729,8 @@ namespace iris {
 
 		std::mutex lock;
 		std::vector<block_t> blocks;
+		std::atomic<size_t> stat_block_count { 0 };
+		std::atomic<size_t> stat_high_water { 0 };
 	};
 
 	// local allocator, allocate memory with specified alignment requirements.
@@ -743,6 +817,7 @@ namespace iris {
 						p->next = nullptr;
 						p->allocator = this;
 						p->ref_count.store(1, std::memory_order_relaxed); // newly allocated one, just set it to 1
+						stat_block_acquire();
 					}
 				} else {
 					p->managed.store(0, std::memory_order_relaxed);
@@ -763,6 +838,7 @@ namespace iris {
 								// add to recycle system if needed
 								recycle_unsafe(p);
 
+								stat_item_acquire();
 								return reinterpret_cast<char*>(p) + index * k;
 							}
 						}
@@ -815,6 +891,7 @@ namespace iris {
 						p->next = nullptr;
 						p->allocator = this;
 						p->ref_count.store(1, std::memory_order_relaxed); // newly allocated one, just set it to 1
+						stat_block_acquire();
 					}
 				} else {
 					p->managed.store(0, std::memory_order_release);
@@ -834,6 +911,7 @@ namespace iris {
 								// add to recycle system if needed
 								recycle_safe(p);
 
+								stat_item_acquire();
 								return reinterpret_cast<char*>(p) + index * k;
 							}
 						}
@@ -855,6 +933,7 @@ namespace iris {
 			auto guard = p->allocator->read_fence();
 
 			IRIS_ASSERT(p->allocator != nullptr);
+			p->allocator->stat_item_release();
 			p->bitmap[id / bits].fetch_and(~(size_t(1) << (id & mask)));
 			p->allocator->recycle_safe(p);
 		}
@@ -866,11 +945,43 @@ namespace iris {
 			auto guard = p->allocator->write_fence();
 
 			IRIS_ASSERT(p->allocator != nullptr);
+			p->allocator->stat_item_release();
 			p->bitmap[id / bits].store(p->bitmap[id / bits].load(std::memory_order_relaxed) & ~(size_t(1) << (id & mask)));
 			p->allocator->recycle_unsafe(p);
 		}
 
+		// lock-free memory snapshot: block counts are always tracked, live
+		// object counts only with IRIS_ENABLE_MEMORY_STATS
+		iris_memory_stats_t get_memory_stats() const noexcept {
+			iris_memory_stats_t stats;
+			stats.block_count = stat_block_count.load(std::memory_order_relaxed);
+			stats.bytes_reserved = stats.block_count * block_size;
+			stats.high_water_bytes = stat_block_high_water.load(std::memory_order_relaxed) * block_size;
+#if IRIS_ENABLE_MEMORY_STATS
+			stats.bytes_in_use = stat_live_count.load(std::memory_order_relaxed) * k;
+#endif
+			return stats;
+		}
+
 	protected:
+		void stat_block_acquire() noexcept {
+			size_t count = stat_block_count.fetch_add(1, std::memory_order_relaxed) + 1;
+			size_t high_water = stat_block_high_water.load(std::memory_order_relaxed);
+			while (count > high_water && !stat_block_high_water.compare_exchange_weak(high_water, count, std::memory_order_relaxed)) {}
+		}
+
+		void stat_block_release() noexcept {
+			stat_block_count.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+#if IRIS_ENABLE_MEMORY_STATS
+		void stat_item_acquire() noexcept { stat_live_count.fetch_add(1, std::memory_order_relaxed); }
+		void stat_item_release() noexcept { stat_live_count.fetch_sub(1, std::memory_order_relaxed); }
+#else
+		void stat_item_acquire() noexcept {}
+		void stat_item_release() noexcept {}
+#endif
+
 		void try_free_safe(control_block_t* p) {
 			IRIS_ASSERT(p->ref_count.load(std::memory_order_acquire) != 0);
 			if (p->ref_count.fetch_sub(1, std::memory_order_release) == 1) {
@@ -878,6 +989,7 @@ namespace iris {
 					IRIS_ASSERT(control_blocks[n].load(std::memory_order_acquire) != p);
 				}
 
+				stat_block_release();
 				get_root_allocator().deallocate(p);
 			}
 		}
@@ -891,6 +1003,7 @@ namespace iris {
 					IRIS_ASSERT(control_blocks[n].load(std::memory_order_relaxed) != p);
 				}
 
+				stat_block_release();
 				get_root_allocator().deallocate(p);
 			}
 		}
@@ -948,6 +1061,11 @@ namespace iris {
 		std::atomic<control_block_t*> recycled_head;
 		std::atomic<size_t> recycle_count;
 		std::atomic<control_block_t*> control_blocks[w];
+		std::atomic<size_t> stat_block_count { 0 };
+		std::atomic<size_t> stat_block_high_water { 0 };
+#if IRIS_ENABLE_MEMORY_STATS
+		std::atomic<size_t> stat_live_count { 0 };
+#endif
 	};
 
 	template <typename element_t, size_t allocator_block_size = default_block_size>
@@ -1024,6 +1142,134 @@ namespace iris {
 		}
 	};
 
+	// thread-local magazine layer over iris_allocator_t: each thread keeps a
+	// small cache of free slots per allocator instance, so alloc/free pairs on
+	// hot paths are served entirely from the magazine and the shared control
+	// block bitmaps are only touched on batch refills and flushes. magazines are
+	// owned by the allocator and flushed on its destruction, which must not run
+	// concurrently with allocations.
+	template <typename element_t, size_t allocator_block_size = default_block_size, size_t magazine_size = 32>
+	struct iris_magazine_allocator_t {
+		static constexpr size_t block_size = allocator_block_size;
+		using value_type = element_t;
+		using pointer = element_t*;
+		using const_pointer = const element_t*;
+		using reference = element_t&;
+		using const_reference = const element_t&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::false_type;
+
+		template <typename morph_t>
+		struct rebind { using other = iris_magazine_allocator_t<morph_t, allocator_block_size, magazine_size>; };
+		using allocator_t = iris_allocator_t<sizeof(element_t), allocator_block_size>;
+
+		iris_magazine_allocator_t() : generation(iris_static_instance_t<std::atomic<size_t>>::get_global().fetch_add(1, std::memory_order_relaxed) + 1) {}
+
+		iris_magazine_allocator_t(const iris_magazine_allocator_t&) = delete;
+		iris_magazine_allocator_t& operator = (const iris_magazine_allocator_t&) = delete;
+
+		~iris_magazine_allocator_t() noexcept {
+			// no concurrent allocations are allowed here
+			for (size_t i = 0; i < magazines.size(); i++) {
+				magazine_t* magazine = magazines[i];
+				while (magazine->count != 0) {
+					allocator_t::deallocate_safe(magazine->slots[--magazine->count]);
+				}
+
+				delete magazine;
+			}
+		}
+
+		element_t* allocate(size_t n) {
+			IRIS_ASSERT(n == 1);
+			magazine_t& magazine = *acquire_magazine();
+
+			if (magazine.count == 0) {
+				// refill half a magazine in one batch
+				do {
+					magazine.slots[magazine.count++] = allocator.allocate_safe();
+				} while (magazine.count < magazine_size / 2);
+			}
+
+			return reinterpret_cast<element_t*>(magazine.slots[--magazine.count]);
+		}
+
+		void deallocate(element_t* p, size_t n) {
+			IRIS_ASSERT(n == 1);
+			magazine_t& magazine = *acquire_magazine();
+
+			if (magazine.count == magazine_size) {
+				// flush half back to the shared allocator
+				do {
+					allocator_t::deallocate_safe(magazine.slots[--magazine.count]);
+				} while (magazine.count > magazine_size / 2);
+			}
+
+			magazine.slots[magazine.count++] = p;
+		}
+
+		template <typename... args_t>
+		void construct(element_t* p, args_t&&... args) {
+			new (p) element_t(std::forward<args_t>(args)...);
+		}
+
+		void destroy(element_t* p) {
+			p->~element_t();
+		}
+
+	protected:
+		struct magazine_t {
+			magazine_t() noexcept : count(0) {}
+
+			void* slots[magazine_size];
+			size_t count;
+		};
+
+		// per-thread registry entries are validated by a globally unique
+		// generation, so stale entries of destroyed allocators are never reused
+		struct registry_entry_t {
+			const void* host;
+			size_t generation;
+			magazine_t* magazine;
+		};
+
+		using registry_t = std::vector<registry_entry_t>;
+
+		magazine_t* acquire_magazine() {
+			registry_t& registry = iris_static_instance_t<registry_t>::get_thread_local();
+			for (size_t i = 0; i < registry.size(); i++) {
+				registry_entry_t& entry = registry[i];
+				if (entry.host == this) {
+					if (entry.generation == generation) {
+						return entry.magazine;
+					}
+
+					// stale entry of a destroyed allocator at the same address
+					entry = registry_entry_t{ this, generation, register_magazine() };
+					return entry.magazine;
+				}
+			}
+
+			registry.emplace_back(registry_entry_t{ this, generation, register_magazine() });
+			return registry.back().magazine;
+		}
+
+		magazine_t* register_magazine() {
+			magazine_t* magazine = new magazine_t();
+			std::lock_guard<std::mutex> guard(magazine_lock);
+			magazines.emplace_back(magazine);
+			return magazine;
+		}
+
+	protected:
+		allocator_t allocator;
+		std::mutex magazine_lock;
+		std::vector<magazine_t*> magazines;
+		size_t generation;
+	};
+
 	template <typename element_t, size_t _block_size = default_block_size>
 	struct iris_shared_object_allocator_t {
 		static constexpr size_t block_size = _block_size;
@@ -1106,6 +1352,127 @@ namespace iris {
 		allocator_t& allocator;
 	};
 
+	// bump-pointer arena for frame-temporary allocations: memory comes from
+	// chained pages, there is no per-object free and reset() recycles all pages
+	// in O(1) for the next frame. not thread-safe, intended for per-frame or
+	// per-thread scratch structures.
+	template <size_t page_size = default_page_size>
+	struct iris_arena_t {
+		iris_arena_t() noexcept : head(nullptr), current(nullptr), current_offset(0) {}
+		iris_arena_t(const iris_arena_t&) = delete;
+		iris_arena_t& operator = (const iris_arena_t&) = delete;
+
+		~iris_arena_t() noexcept {
+			page_t* p = head;
+			while (p != nullptr) {
+				page_t* q = p->next;
+				iris_free_aligned(p, sizeof(page_t) + p->capacity);
+				p = q;
+			}
+		}
+
+		void* allocate(size_t size, size_t alignment) {
+			IRIS_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+			if (current != nullptr) {
+				size_t offset = iris_to_alignment(current_offset, alignment);
+				if (offset + size <= current->capacity) {
+					current_offset = offset + size;
+					return reinterpret_cast<uint8_t*>(current + 1) + offset;
+				}
+			}
+
+			// advance to the next page, reusing recycled ones before growing
+			page_t* next = current != nullptr ? current->next : head;
+			while (next != nullptr && next->capacity < size) {
+				current = next;
+				next = next->next;
+			}
+
+			if (next == nullptr) {
+				size_t capacity = std::max(page_size - sizeof(page_t), size);
+				next = reinterpret_cast<page_t*>(iris_alloc_aligned(sizeof(page_t) + capacity, iris_get_alignment(sizeof(page_t))));
+				next->next = nullptr;
+				next->capacity = capacity;
+
+				if (current != nullptr) {
+					current->next = next;
+				} else {
+					head = next;
+				}
+			}
+
+			current = next;
+			current_offset = size;
+			return reinterpret_cast<uint8_t*>(current + 1);
+		}
+
+		// recycle all pages at once, previously allocated objects must be dead
+		void reset() noexcept {
+			current = head;
+			current_offset = 0;
+		}
+
+	protected:
+		struct page_t {
+			page_t* next;
+			size_t capacity;
+		};
+
+		page_t* head; // first page, retained across reset()
+		page_t* current; // page serving allocations
+		size_t current_offset; // bump offset in current page
+	};
+
+	// allocator facade over a shared iris_arena_t, compatible with the
+	// allocator_t template parameter of the iris containers (wrap it in a
+	// single-parameter alias template first). deallocate is a no-op.
+	template <typename element_t, size_t page_size = default_page_size>
+	struct iris_arena_allocator_t {
+		static constexpr size_t block_size = default_block_size;
+		using value_type = element_t;
+		using pointer = element_t*;
+		using const_pointer = const element_t*;
+		using reference = element_t&;
+		using const_reference = const element_t&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::false_type;
+
+		template <typename morph_t>
+		struct rebind { using other = iris_arena_allocator_t<morph_t, page_size>; };
+		using allocator_t = iris_arena_t<page_size>;
+
+		iris_arena_allocator_t(allocator_t& a) noexcept : arena(a) {}
+
+		template <typename value_t>
+		iris_arena_allocator_t(const iris_arena_allocator_t<value_t, page_size>& rhs) noexcept : arena(rhs.arena) {}
+
+		bool operator == (const iris_arena_allocator_t& rhs) const noexcept {
+			return &arena == &rhs.arena;
+		}
+
+		element_t* allocate(size_t n) {
+			return reinterpret_cast<element_t*>(arena.allocate(n * sizeof(element_t), alignof(element_t)));
+		}
+
+		void deallocate(element_t* p, size_t n) noexcept {
+			// no per-object free, the arena reclaims everything on reset()
+		}
+
+		template <typename... args_t>
+		void construct(element_t* p, args_t&&... args) {
+			new (p) element_t(std::forward<args_t>(args)...);
+		}
+
+		void destroy(element_t* p) {
+			p->~element_t();
+		}
+
+		allocator_t& arena;
+	};
+
 	template <typename element_t, size_t alloc_size = default_block_size, size_t page_size = default_page_size / default_block_size, template <typename...> class single_allocator_t = std::allocator>
 	struct iris_block_allocator_t : single_allocator_t<element_t> {
 		using value_type = element_t;
@@ -1163,6 +1530,12 @@ namespace iris {
 	template <typename element_t>
 	using iris_default_object_allocator_t = iris_object_allocator_t<element_t>;
 
+	template <typename element_t>
+	using iris_default_magazine_allocator_t = iris_magazine_allocator_t<element_t>;
+
+	template <typename element_t>
+	using iris_default_arena_allocator_t = iris_arena_allocator_t<element_t>;
+
 	template <typename element_t>
 	using iris_default_relaxed_object_allocator_t = iris_relaxed_object_allocator_t<element_t>;
 
@@ -1255,6 +1628,28 @@ namespace iris {
 			return result;
 		}
 
+		// construct an element in place from constructor arguments, saving the
+		// intermediate construct+move of push() for multi-argument elements
+		template <typename... args_t>
+		element_t* emplace(args_t&&... args) noexcept(noexcept(element_t(std::forward<args_t>(args)...))) {
+			auto in_guard = in_fence();
+
+			if (full()) {
+				return nullptr; // this queue is full, emplace failed
+			}
+
+			element_t* result = new (&ring_buffer[push_count % element_count]) element_t(std::forward<args_t>(args)...);
+
+			// place a thread_fence here to ensure that change of ring_buffer[push_index]
+			//   must be visible to other threads after push_count being updated.
+			if /* constexpr */ (enable_memory_fence) {
+				std::atomic_thread_fence(std::memory_order_release);
+			}
+
+			push_count = step_counter(push_count, 1);
+			return result;
+		}
+
 		element_t& top() noexcept {
 			auto guard = out_fence();
 			IRIS_ASSERT(!empty()); // must checked before calling me (memory fence acquire implicited)
@@ -1312,6 +1707,78 @@ namespace iris {
 			return from;
 		}
 
+		// bulk push for trivially copyable types: copies whole runs with memcpy
+		// and updates the write index once. returns the count actually pushed,
+		// which may be less than count if the queue runs full.
+		template <typename type_t = element_t>
+		typename std::enable_if<std::is_trivially_copyable<type_t>::value, size_t>::type push_n(const element_t* source, size_t count) noexcept {
+			auto guard = in_fence();
+
+			size_t n = std::min(count, element_count - size());
+			if (n == 0) {
+				return 0;
+			}
+
+			size_t windex = push_count % element_count;
+			size_t run = std::min(n, element_count - windex);
+			std::memcpy(&ring_buffer[windex], source, run * sizeof(element_t));
+			if (run != n) {
+				std::memcpy(&ring_buffer[0], source + run, (n - run) * sizeof(element_t));
+			}
+
+			// place a thread_fence here to ensure that change of ring_buffer
+			//   must be visible to other threads after push_count being updated.
+			if /* constexpr */ (enable_memory_fence) {
+				std::atomic_thread_fence(std::memory_order_release);
+			}
+
+			push_count = step_counter(push_count, (ptrdiff_t)n);
+			return n;
+		}
+
+		// bulk pop counterpart of push_n, returns the count actually popped
+		template <typename type_t = element_t>
+		typename std::enable_if<std::is_trivially_copyable<type_t>::value, size_t>::type pop_n(element_t* target, size_t count) noexcept {
+			auto guard = out_fence();
+
+			size_t n = std::min(count, size());
+			if (n == 0) {
+				return 0;
+			}
+
+			size_t rindex = pop_count % element_count;
+			size_t run = std::min(n, element_count - rindex);
+			std::memcpy(target, &ring_buffer[rindex], run * sizeof(element_t));
+			if (run != n) {
+				std::memcpy(target + run, &ring_buffer[0], (n - run) * sizeof(element_t));
+			}
+
+			// place a thread_fence here to ensure that change of ring_buffer
+			//   must be visible to other threads after pop_count being updated.
+			if /* constexpr */ (enable_memory_fence) {
+				std::atomic_thread_fence(std::memory_order_release);
+			}
+
+			pop_count = step_counter(pop_count, (ptrdiff_t)n);
+			return n;
+		}
+
+		// zero-copy read: returns the longest contiguous run at the front and its
+		// length, or nullptr when empty. consume it with pop(count) afterwards.
+		const element_t* peek(size_t& count) const noexcept {
+			auto guard = out_fence();
+
+			size_t n = size();
+			if (n == 0) {
+				count = 0;
+				return nullptr;
+			}
+
+			size_t rindex = pop_count % element_count;
+			count = std::min(n, element_count - rindex);
+			return reinterpret_cast<const element_t*>(&ring_buffer[rindex]);
+		}
+
 		template <typename iterator_t>
 		iterator_t pop(iterator_t from, iterator_t to) noexcept {
 			auto guard = out_fence();
@@ -1749,69 +2216,437 @@ namespace iris {
 		storage_t* ring_buffer;
 	};
 
-	namespace impl {
-		template <typename element_t, template <typename...> class allocator_t, bool enable_memory_fence>
-		using sub_queue_t = iris_queue_t<element_t, allocator_t, enable_memory_fence>;
+	// bounded mpmc queue with per-slot sequence numbers (vyukov-style), so
+	// producers and consumers on any thread push/pop with one cas each. the
+	// capacity is the largest power of two count of slots fitting in one block.
+	// the spsc iris_queue_t stays the fast path, use iris_queue_select_t to pick
+	// an implementation via a template flag.
+	template <typename value_t, template <typename...> class allocator_t = iris_default_block_allocator_t>
+	struct iris_queue_mpmc_t {
+		using element_t = value_t;
 
-		template <typename element_t, template <typename...> class allocator_t, bool enable_memory_fence, template <typename...> class debug_allocator_t = allocator_t>
-		struct node_t : sub_queue_t<element_t, debug_allocator_t, enable_memory_fence> {
-			template <typename alloc_rebind_t>
-			explicit node_t(const alloc_rebind_t& allocator, size_t init_count) : sub_queue_t<element_t, debug_allocator_t, enable_memory_fence>(allocator, init_count), next(nullptr) {}
-			node_t* next; // chain next queue
+		struct slot_t {
+			std::atomic<size_t> sequence;
+			impl::element_slot_t<element_t> value;
 		};
-	}
-
-	// chain kfifos to make variant capacity.
-	template <typename value_t, template <typename...> class allocator_t = iris_default_block_allocator_t, bool enable_memory_fence = true, template <typename...> class debug_allocator_t = allocator_t>
-	struct iris_queue_list_t : protected allocator_t<impl::node_t<value_t, allocator_t, enable_memory_fence>>, protected enable_in_out_fence_t<> {
-		using element_t = value_t;
-		using node_t = impl::node_t<element_t, debug_allocator_t, enable_memory_fence>;
-		using node_allocator_t = debug_allocator_t<node_t>;
 
-		static constexpr size_t block_size = iris_extract_block_size<element_t, debug_allocator_t>::value;
-		static constexpr size_t element_count = block_size / sizeof(element_t);
+		using node_allocator_t = allocator_t<slot_t>;
+		static constexpr size_t block_size = iris_extract_block_size<slot_t, allocator_t>::value;
+		static constexpr size_t slot_count = block_size / sizeof(slot_t);
+		static constexpr size_t capacity = size_t(1) << iris_log2<slot_count>::value;
+		static_assert(capacity >= 2, "block_size is too small!");
+		static constexpr size_t index_mask = capacity - 1;
 
-		// do not copy this structure, only to move
-		iris_queue_list_t(const iris_queue_list_t& rhs) = delete;
-		iris_queue_list_t& operator = (const iris_queue_list_t& rhs) = delete;
+		iris_queue_mpmc_t() : ring_buffer(node_allocator.allocate(capacity)) {
+			for (size_t i = 0; i < capacity; i++) {
+				ring_buffer[i].sequence.store(i, std::memory_order_relaxed);
+			}
 
-		explicit iris_queue_list_t(const node_allocator_t& allocator) noexcept(noexcept(std::declval<node_allocator_t>().allocate(1))) : node_allocator_t(allocator), push_head(nullptr), pop_head(nullptr) {
-			node_t* p = node_allocator_t::allocate(1);
-			new (p) node_t(static_cast<node_allocator_t&>(*this), 0);
-			push_head = pop_head = p;
-			iterator_counter = element_count;
+			enqueue_count.store(0, std::memory_order_relaxed);
+			dequeue_count.store(0, std::memory_order_release);
 		}
 
-		iris_queue_list_t() noexcept(noexcept(std::declval<node_allocator_t>().allocate(1))) : push_head(nullptr), pop_head(nullptr) {
-			node_t* p = node_allocator_t::allocate(1);
-			new (p) node_t(static_cast<node_allocator_t&>(*this), 0);
-			push_head = pop_head = p;
-			iterator_counter = element_count;
-		}
+		iris_queue_mpmc_t(const iris_queue_mpmc_t&) = delete;
+		iris_queue_mpmc_t& operator = (const iris_queue_mpmc_t&) = delete;
 
-		iris_queue_list_t(iris_queue_list_t&& rhs) noexcept {
-			IRIS_ASSERT(static_cast<node_allocator_t&>(*this) == static_cast<node_allocator_t&>(rhs));
-			push_head = rhs.push_head;
-			pop_head = rhs.pop_head;
-			iterator_counter = rhs.iterator_counter;
+		~iris_queue_mpmc_t() noexcept {
+			// no concurrent accesses are allowed here, destroy remaining elements in place
+			size_t dequeue = dequeue_count.load(std::memory_order_acquire);
+			size_t enqueue = enqueue_count.load(std::memory_order_relaxed);
 
-			rhs.push_head = nullptr;
-			rhs.pop_head = nullptr;
+			while (dequeue != enqueue) {
+				slot_t& slot = ring_buffer[dequeue & index_mask];
+				if (slot.sequence.load(std::memory_order_relaxed) == dequeue + 1) {
+					reinterpret_cast<element_t*>(&slot.value)->~element_t();
+				}
+
+				dequeue++;
+			}
+
+			node_allocator.deallocate(ring_buffer, capacity);
 		}
 
-		iris_queue_list_t& operator = (iris_queue_list_t&& rhs) noexcept {
-			if (this != &rhs) {
+		// push an element from any thread, returns false if the queue is full
+		template <typename input_element_t>
+		bool push(input_element_t&& t) {
+			size_t pos = enqueue_count.load(std::memory_order_relaxed);
+			while (true) {
+				slot_t& slot = ring_buffer[pos & index_mask];
+				size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)pos;
+
+				if (diff == 0) {
+					if (enqueue_count.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						new (&slot.value) element_t(std::forward<input_element_t>(t));
+						slot.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				} else if (diff < 0) {
+					return false; // full
+				} else {
+					pos = enqueue_count.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// pop an element from any thread, returns false if the queue is empty
+		bool pop(element_t& t) noexcept(noexcept(t = std::move(t))) {
+			size_t pos = dequeue_count.load(std::memory_order_relaxed);
+			while (true) {
+				slot_t& slot = ring_buffer[pos & index_mask];
+				size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)(pos + 1);
+
+				if (diff == 0) {
+					if (dequeue_count.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						element_t& element = *reinterpret_cast<element_t*>(&slot.value);
+						t = std::move(element);
+						element.~element_t();
+						slot.sequence.store(pos + capacity, std::memory_order_release);
+						return true;
+					}
+				} else if (diff < 0) {
+					return false; // empty
+				} else {
+					pos = dequeue_count.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		// approximate under concurrent accesses
+		size_t size() const noexcept {
+			size_t enqueue = enqueue_count.load(std::memory_order_acquire);
+			size_t dequeue = dequeue_count.load(std::memory_order_acquire);
+			return enqueue >= dequeue ? enqueue - dequeue : 0;
+		}
+
+		static constexpr size_t full_pack_size() noexcept {
+			return capacity;
+		}
+
+	protected:
+		node_allocator_t node_allocator;
+		std::atomic<size_t> enqueue_count; // push side
+		std::atomic<size_t> dequeue_count; // pop side
+		slot_t* ring_buffer;
+	};
+
+	// spsc queue over a caller-provided memory region, e.g. a shared memory
+	// mapping between two processes: the layout is a fixed header with in/out
+	// counters followed by the element slots, with no internal pointers or
+	// allocation, so both sides may map the region at different addresses.
+	// elements must be trivially copyable. notification uses the C++20 atomic
+	// wait/notify (futex-backed where available) and falls back to a
+	// pause/yield spin otherwise.
+	template <typename value_t>
+	struct iris_shm_queue_t {
+		using element_t = value_t;
+		static_assert(std::is_trivially_copy_constructible<element_t>::value && std::is_trivially_destructible<element_t>::value, "element_t must be trivially copyable for shared memory!");
+
+		static constexpr uint32_t region_magic = 0x53495251u; // 'QRIS'
+
+		struct header_t {
+			uint32_t magic;
+			uint32_t capacity; // power of two
+			std::atomic<uint32_t> push_count;
+			std::atomic<uint32_t> pop_count;
+		};
+
+		// bytes required for a queue of the given power-of-two capacity
+		static constexpr size_t size_required(size_t capacity) noexcept {
+			return sizeof(header_t) + capacity * sizeof(element_t);
+		}
+
+		iris_shm_queue_t() noexcept : header(nullptr), slots(nullptr) {}
+
+		// initialize a fresh queue over the region (producer or owner side)
+		bool create(void* region, size_t bytes, size_t capacity) {
+			IRIS_ASSERT(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+			if (region == nullptr || bytes < size_required(capacity)) {
+				return false;
+			}
+
+			header = reinterpret_cast<header_t*>(region);
+			header->capacity = iris_verify_cast<uint32_t>(capacity);
+			header->push_count.store(0, std::memory_order_relaxed);
+			header->pop_count.store(0, std::memory_order_relaxed);
+			slots = reinterpret_cast<element_t*>(header + 1);
+			std::atomic_thread_fence(std::memory_order_release);
+			header->magic = region_magic;
+			return true;
+		}
+
+		// bind to a region initialized by the other side
+		bool attach(void* region, size_t bytes) {
+			if (region == nullptr || bytes < sizeof(header_t)) {
+				return false;
+			}
+
+			header_t* h = reinterpret_cast<header_t*>(region);
+			if (h->magic != region_magic || h->capacity < 2 || (h->capacity & (h->capacity - 1)) != 0 || bytes < size_required(h->capacity)) {
+				return false;
+			}
+
+			header = h;
+			slots = reinterpret_cast<element_t*>(header + 1);
+			return true;
+		}
+
+		// push from the producer process, returns false when full
+		bool push(const element_t& t) noexcept {
+			uint32_t push_count = header->push_count.load(std::memory_order_relaxed);
+			if (push_count - header->pop_count.load(std::memory_order_acquire) >= header->capacity) {
+				return false; // full
+			}
+
+			std::memcpy(&slots[push_count & (header->capacity - 1)], &t, sizeof(element_t));
+			header->push_count.store(push_count + 1, std::memory_order_release);
+			notify(header->push_count);
+			return true;
+		}
+
+		// pop from the consumer process, returns false when empty
+		bool pop(element_t& t) noexcept {
+			uint32_t pop_count = header->pop_count.load(std::memory_order_relaxed);
+			if (pop_count == header->push_count.load(std::memory_order_acquire)) {
+				return false; // empty
+			}
+
+			std::memcpy(&t, &slots[pop_count & (header->capacity - 1)], sizeof(element_t));
+			header->pop_count.store(pop_count + 1, std::memory_order_release);
+			notify(header->pop_count);
+			return true;
+		}
+
+		// blocking pop: bounded spin with pause first, then futex-style wait
+		bool pop_wait(element_t& t, size_t spin_limit = 1024) noexcept {
+			for (size_t i = 0; i < spin_limit; i++) {
+				if (pop(t)) {
+					return true;
+				}
+
+				iris_thread_pause();
+			}
+
+			while (true) {
+				// snapshot the producer counter before attempting the pop: a push
+				// landing between a failed pop and the wait then changes the
+				// value we sleep on, so the notify cannot be lost
+				uint32_t observed = header->push_count.load(std::memory_order_acquire);
+				if (pop(t)) {
+					return true;
+				}
+
+				wait(header->push_count, observed);
+			}
+		}
+
+		size_t size() const noexcept {
+			return header->push_count.load(std::memory_order_acquire) - header->pop_count.load(std::memory_order_acquire);
+		}
+
+		bool empty() const noexcept {
+			return size() == 0;
+		}
+
+	protected:
+		static void notify(std::atomic<uint32_t>& variable) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+			variable.notify_one();
+#endif
+		}
+
+		static void wait(std::atomic<uint32_t>& variable, uint32_t value) noexcept {
+#if defined(__cpp_lib_atomic_wait)
+			variable.wait(value, std::memory_order_acquire);
+#else
+			if (variable.load(std::memory_order_acquire) == value) {
+				std::this_thread::yield();
+			}
+#endif
+		}
+
+	protected:
+		header_t* header;
+		element_t* slots;
+	};
+
+	// select queue implementation via template flag: mpmc or the default spsc
+	template <typename value_t, template <typename...> class allocator_t = iris_default_block_allocator_t, bool enable_mpmc = false>
+	using iris_queue_select_t = typename std::conditional<enable_mpmc, iris_queue_mpmc_t<value_t, allocator_t>, iris_queue_t<value_t, allocator_t>>::type;
+
+	namespace impl {
+		template <typename element_t, template <typename...> class allocator_t, bool enable_memory_fence>
+		using sub_queue_t = iris_queue_t<element_t, allocator_t, enable_memory_fence>;
+
+		template <typename element_t, template <typename...> class allocator_t, bool enable_memory_fence, template <typename...> class debug_allocator_t = allocator_t>
+		struct node_t : sub_queue_t<element_t, debug_allocator_t, enable_memory_fence> {
+			template <typename alloc_rebind_t>
+			explicit node_t(const alloc_rebind_t& allocator, size_t init_count) : sub_queue_t<element_t, debug_allocator_t, enable_memory_fence>(allocator, init_count), next(nullptr) {}
+			node_t* next; // chain next queue
+		};
+	}
+
+	namespace impl {
+		// two-parity epoch domain for single-writer/multi-reader reclamation:
+		// readers pin the current epoch, the writer advances it only when the
+		// previous parity has drained, and frees retirements two epochs old
+		struct epoch_domain_t {
+			epoch_domain_t() noexcept {
+				global_epoch.store(0, std::memory_order_relaxed);
+				active_readers[0].store(0, std::memory_order_relaxed);
+				active_readers[1].store(0, std::memory_order_release);
+			}
+
+			size_t reader_enter() noexcept {
+				while (true) {
+					size_t epoch = global_epoch.load(std::memory_order_acquire);
+					active_readers[epoch & 1].fetch_add(1, std::memory_order_acq_rel);
+					if (global_epoch.load(std::memory_order_acquire) == epoch) {
+						return epoch;
+					}
+
+					// epoch moved mid-entry, retry on the fresh one
+					active_readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+				}
+			}
+
+			void reader_exit(size_t epoch) noexcept {
+				active_readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+			}
+
+			// writer side: advance when the previous parity has no readers left
+			bool try_advance() noexcept {
+				size_t epoch = global_epoch.load(std::memory_order_relaxed);
+				if (active_readers[(epoch + 1) & 1].load(std::memory_order_acquire) == 0) {
+					global_epoch.store(epoch + 1, std::memory_order_release);
+					return true;
+				}
+
+				return false;
+			}
+
+			size_t current() const noexcept {
+				return global_epoch.load(std::memory_order_relaxed);
+			}
+
+			std::atomic<size_t> global_epoch;
+			std::atomic<size_t> active_readers[2];
+		};
+
+		template <typename node_t>
+		struct epoch_state_t {
+			epoch_state_t() noexcept {
+				published_pop_head.store(nullptr, std::memory_order_relaxed);
+				published_push_head.store(nullptr, std::memory_order_release);
+			}
+
+			epoch_domain_t domain;
+			// the writer publishes its plain head/tail pointers here so the
+			// read-side snapshot walk is free of data races
+			std::atomic<node_t*> published_pop_head;
+			std::atomic<node_t*> published_push_head;
+			std::vector<node_t*> retired[3]; // by epoch mod 3, freed two epochs later
+		};
+
+		struct epoch_disabled_t {};
+
+		// o(1) size accounting for iris_queue_list_t, see enable_counter
+		struct queue_counter_enabled_t {
+			queue_counter_enabled_t() noexcept { value.store(0, std::memory_order_relaxed); }
+			void add(size_t count) noexcept { value.fetch_add(count, std::memory_order_relaxed); }
+			void sub(size_t count) noexcept { value.fetch_sub(count, std::memory_order_relaxed); }
+			void reset() noexcept { value.store(0, std::memory_order_relaxed); }
+			size_t get() const noexcept { return value.load(std::memory_order_relaxed); }
+			void swap(queue_counter_enabled_t& rhs) noexcept {
+				size_t t = value.load(std::memory_order_relaxed);
+				value.store(rhs.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				rhs.value.store(t, std::memory_order_relaxed);
+			}
+
+			std::atomic<size_t> value;
+		};
+
+		struct queue_counter_disabled_t {
+			void add(size_t) noexcept {}
+			void sub(size_t) noexcept {}
+			void reset() noexcept {}
+			size_t get() const noexcept { return 0; }
+			void swap(queue_counter_disabled_t&) noexcept {}
+		};
+	}
+
+	// chain kfifos to make variant capacity.
+	// set enable_counter for o(1) size() via a relaxed atomic count maintained
+	// on push/pop, approximate under concurrency; by default size() keeps the
+	// exact per-node walk.
+	// set enable_epoch for single-writer/multi-reader traversal: nodes emptied
+	// by the consumer are retired per epoch instead of freed, and reclaimed two
+	// epochs later once no reader pins them (see reader_acquire/for_each_concurrent).
+	template <typename value_t, template <typename...> class allocator_t = iris_default_block_allocator_t, bool enable_memory_fence = true, template <typename...> class debug_allocator_t = allocator_t, bool enable_counter = false, bool enable_epoch = false>
+	struct iris_queue_list_t : protected allocator_t<impl::node_t<value_t, allocator_t, enable_memory_fence>>, protected enable_in_out_fence_t<> {
+		using element_t = value_t;
+		using node_t = impl::node_t<element_t, debug_allocator_t, enable_memory_fence>;
+		using node_allocator_t = debug_allocator_t<node_t>;
+
+		static constexpr size_t block_size = iris_extract_block_size<element_t, debug_allocator_t>::value;
+		static constexpr size_t element_count = block_size / sizeof(element_t);
+
+		// do not copy this structure, only to move
+		iris_queue_list_t(const iris_queue_list_t& rhs) = delete;
+		iris_queue_list_t& operator = (const iris_queue_list_t& rhs) = delete;
+
+		explicit iris_queue_list_t(const node_allocator_t& allocator) noexcept(noexcept(std::declval<node_allocator_t>().allocate(1))) : node_allocator_t(allocator), push_head(nullptr), pop_head(nullptr) {
+			node_t* p = node_allocator_t::allocate(1);
+			new (p) node_t(static_cast<node_allocator_t&>(*this), 0);
+			push_head = pop_head = p;
+			iterator_counter = element_count;
+			publish_heads();
+		}
+
+		iris_queue_list_t() noexcept(noexcept(std::declval<node_allocator_t>().allocate(1))) : push_head(nullptr), pop_head(nullptr) {
+			node_t* p = node_allocator_t::allocate(1);
+			new (p) node_t(static_cast<node_allocator_t&>(*this), 0);
+			push_head = pop_head = p;
+			iterator_counter = element_count;
+			publish_heads();
+		}
+
+		iris_queue_list_t(iris_queue_list_t&& rhs) noexcept {
+			IRIS_ASSERT(static_cast<node_allocator_t&>(*this) == static_cast<node_allocator_t&>(rhs));
+			push_head = rhs.push_head;
+			pop_head = rhs.pop_head;
+			iterator_counter = rhs.iterator_counter;
+			element_counter.swap(rhs.element_counter);
+
+			rhs.push_head = nullptr;
+			rhs.pop_head = nullptr;
+			publish_heads();
+		}
+
+		iris_queue_list_t& operator = (iris_queue_list_t&& rhs) noexcept {
+			if (this != &rhs) {
 				IRIS_ASSERT(static_cast<node_allocator_t&>(*this) == static_cast<node_allocator_t&>(rhs));
 				// just swap pointers.
 				std::swap(push_head, rhs.push_head);
 				std::swap(pop_head, rhs.pop_head);
 				std::swap(iterator_counter, rhs.iterator_counter);
+				element_counter.swap(rhs.element_counter);
+				publish_heads();
+				rhs.publish_heads();
 			}
 
 			return *this;
 		}
 
 		~iris_queue_list_t() noexcept {
+			// no concurrent readers are allowed here
+			clear_retired<enable_epoch>();
+
 			if (pop_head != nullptr) {
 				node_t* q = pop_head;
 				while (q != nullptr) {
@@ -1824,55 +2659,164 @@ namespace iris {
 			}
 		}
 	
+		// preallocate spare nodes covering at least n more elements beyond the
+		// current tail, so bursty producers never allocate mid-burst. spares are
+		// activated by push as the head fills.
+		void reserve(size_t n) {
+			auto guard = in_fence();
+
+			node_t* p = push_head;
+			size_t spare = 0;
+			while (p->next != nullptr) {
+				p = p->next;
+				spare += element_count;
+			}
+
+			while (spare < n) {
+				node_t* q = node_allocator_t::allocate(1);
+				new (q) node_t(static_cast<node_allocator_t&>(*this), 0);
+				p->next = q;
+				p = q;
+				spare += element_count;
+			}
+		}
+
+		// how many nodes an overflow grows by: with a factor above one, extra
+		// spare nodes are pre-chained so bursts amortize allocator hits
+		void set_growth_factor(size_t factor) noexcept {
+			growth_factor = std::max(factor, (size_t)1);
+		}
+
 		template <typename input_element_t>
 		element_t* push(input_element_t&& t) noexcept(noexcept(std::declval<node_t>().push(std::forward<input_element_t>(t)))) {
 			auto guard = in_fence();
 
 			if (push_head->full()) {
-				node_t* p = node_allocator_t::allocate(1);
-				new (p) node_t(static_cast<node_allocator_t&>(*this), iterator_counter);
-				iterator_counter = node_t::step_counter(iterator_counter, element_count);
+				node_t* p = acquire_grow_node();
 				element_t* w = p->push(std::forward<input_element_t>(t));
 
-				// chain new node_t at head.
-				push_head->next = p;
-
 				if (enable_memory_fence) {
 					std::atomic_thread_fence(std::memory_order_release);
 				}
 
 				push_head = p;
+				publish_heads();
+				element_counter.add(1);
 				return w;
 			} else {
-				return push_head->push(std::forward<input_element_t>(t));
+				element_t* w = push_head->push(std::forward<input_element_t>(t));
+				element_counter.add(1);
+				return w;
 			}
 		}
 
 		template <typename iterator_t>
 		iterator_t push(iterator_t from, iterator_t to) noexcept(noexcept(std::declval<node_t>().push(from, to))) {
 			auto guard = in_fence();
+			iterator_t org = from;
 			from = push_head->push(from, to);
 
 			while (from != to) {
 				// full
-				node_t* p = node_allocator_t::allocate(1);
-				new (p) node_t(static_cast<node_allocator_t&>(*this), iterator_counter);
-				iterator_counter = node_t::step_counter(iterator_counter, element_count);
+				node_t* p = acquire_grow_node();
 				from = p->push(from, to);
 
-				// chain new node_t at head.
-				push_head->next = p;
-
 				if (enable_memory_fence) {
 					std::atomic_thread_fence(std::memory_order_release);
 				}
 
 				push_head = p;
+				publish_heads();
 			}
 
+			element_counter.add(iris_verify_cast<size_t>(from - org));
 			return from;
 		}
 
+		// construct an element in place at the tail from constructor arguments
+		template <typename... args_t>
+		element_t* emplace(args_t&&... args) {
+			auto guard = in_fence();
+
+			element_t* w = push_head->emplace(std::forward<args_t>(args)...);
+			if (w == nullptr) {
+				// full
+				node_t* p = acquire_grow_node();
+				w = p->emplace(std::forward<args_t>(args)...);
+
+				if (enable_memory_fence) {
+					std::atomic_thread_fence(std::memory_order_release);
+				}
+
+				push_head = p;
+				publish_heads();
+			}
+
+			element_counter.add(1);
+			return w;
+		}
+
+		// bulk push for trivially copyable types: whole runs are memcpy'd into
+		// each node and the indices are updated once per node.
+		template <typename type_t = element_t>
+		typename std::enable_if<std::is_trivially_copyable<type_t>::value>::type push_n(const element_t* source, size_t count) {
+			auto guard = in_fence();
+
+			size_t total = count;
+			size_t pushed = push_head->push_n(source, count);
+			source += pushed;
+			count -= pushed;
+
+			while (count != 0) {
+				// full
+				node_t* p = acquire_grow_node();
+				pushed = p->push_n(source, count);
+				source += pushed;
+				count -= pushed;
+
+				if (enable_memory_fence) {
+					std::atomic_thread_fence(std::memory_order_release);
+				}
+
+				push_head = p;
+				publish_heads();
+			}
+
+			element_counter.add(total);
+		}
+
+		// bulk pop counterpart of push_n, returns the count actually popped
+		template <typename type_t = element_t>
+		typename std::enable_if<std::is_trivially_copyable<type_t>::value, size_t>::type pop_n(element_t* target, size_t count) noexcept {
+			auto guard = out_fence();
+
+			size_t total = 0;
+			while (count != 0) {
+				size_t popped = pop_head->pop_n(target, count);
+				target += popped;
+				count -= popped;
+				total += popped;
+
+				if (popped == 0 && !cleanup_empty()) {
+					break;
+				}
+			}
+
+			element_counter.sub(total);
+			return total;
+		}
+
+		// zero-copy read of the longest contiguous run at the front of the first
+		// node, consume with pop(count). nullptr when empty.
+		const element_t* peek(size_t& count) noexcept {
+			auto guard = out_fence();
+			if /* constexpr */ (enable_memory_fence) {
+				cleanup_empty();
+			}
+
+			return pop_head->peek(count);
+		}
+
 		size_t end_index() const noexcept {
 			return push_head->end_index();
 		}
@@ -1881,6 +2825,19 @@ namespace iris {
 			return pop_head->begin_index();
 		}
 
+		// memory snapshot: node chain footprint plus live element bytes
+		iris_memory_stats_t get_memory_stats() const noexcept {
+			iris_memory_stats_t stats;
+			for (const node_t* p = pop_head; p != nullptr; p = p->next) {
+				stats.block_count++;
+			}
+
+			stats.bytes_reserved = stats.block_count * block_size;
+			stats.high_water_bytes = stats.bytes_reserved;
+			stats.bytes_in_use = size() * sizeof(element_t);
+			return stats;
+		}
+
 		const element_t& get(size_t index) const noexcept {
 			auto guard = out_fence();
 
@@ -1908,13 +2865,16 @@ namespace iris {
 		iterator_t pop(iterator_t from, iterator_t to) noexcept {
 			auto guard = out_fence();
 
+			iterator_t org = from;
 			while (true) {
 				iterator_t next = pop_head->pop(from, to);
 				if (from == next) {
 					cleanup_empty();
 
-					if (next == to)
+					if (next == to) {
+						element_counter.sub(iris_verify_cast<size_t>(next - org));
 						return next;
+					}
 				}
 
 				from = next;
@@ -1926,15 +2886,42 @@ namespace iris {
 			if (pop_head->empty() && pop_head != push_head) {
 				node_t* p = pop_head;
 				pop_head = pop_head->next;
+				publish_heads();
 
-				p->~node_t();
-				node_allocator_t::deallocate(p, 1);
+				release_node(p, std::integral_constant<bool, enable_epoch>());
 				return true;
 			} else {
 				return false;
 			}
 		}
 
+		// pin the current epoch so retired nodes stay mapped while iterating,
+		// pair with reader_release. only meaningful in epoch mode.
+		size_t reader_acquire() noexcept {
+			static_assert(enable_epoch, "reader_acquire requires enable_epoch!");
+			return epoch_state.domain.reader_enter();
+		}
+
+		void reader_release(size_t epoch) noexcept {
+			static_assert(enable_epoch, "reader_release requires enable_epoch!");
+			epoch_state.domain.reader_exit(epoch);
+		}
+
+		// concurrent read-side traversal under an acquired epoch: walks the
+		// chain without mutating it while a single writer keeps pushing and
+		// popping. elements may be concurrently consumed, so op must tolerate
+		// values being popped behind it; node memory stays valid.
+		template <typename operation_t>
+		void for_each_concurrent(operation_t&& op) const {
+			static_assert(enable_epoch, "for_each_concurrent requires enable_epoch!");
+			const node_t* tail = epoch_state.published_push_head.load(std::memory_order_acquire);
+			const node_t* head = epoch_state.published_pop_head.load(std::memory_order_acquire);
+
+			for (const node_t* p = head; p != nullptr; p = (p == tail ? nullptr : p->next)) {
+				p->for_each(op);
+			}
+		}
+
 		element_t& top() noexcept {
 			auto guard = out_fence();
 			if /* constexpr */ (enable_memory_fence) {
@@ -1961,6 +2948,7 @@ namespace iris {
 			}
 
 			pop_head->pop();
+			element_counter.sub(1);
 			cleanup_empty();
 		}
 
@@ -1971,6 +2959,7 @@ namespace iris {
 				cleanup_empty();
 			}
 
+			size_t requested = n;
 			while (n != 0) {
 				size_t m = std::min(n, pop_head->size());
 				pop_head->pop(m);
@@ -1982,6 +2971,7 @@ namespace iris {
 				}
 			}
 
+			element_counter.sub(requested - n);
 			return n;
 		}
 
@@ -2015,6 +3005,14 @@ namespace iris {
 		}
 
 		size_t size() const noexcept {
+			return size_impl(std::integral_constant<bool, enable_counter>());
+		}
+
+		size_t size_impl(std::true_type) const noexcept {
+			return element_counter.get();
+		}
+
+		size_t size_impl(std::false_type) const noexcept {
 			size_t counter = 0;
 			// sum up all sub queues
 			for (node_t* p = pop_head; p != push_head->next; p = p->next) {
@@ -2062,6 +3060,8 @@ namespace iris {
 			}
 
 			q->next = nullptr;
+			element_counter.reset();
+			publish_heads();
 		}
 
 		void clear() noexcept {
@@ -2072,6 +3072,12 @@ namespace iris {
 		void for_each(operation_t&& op) noexcept(noexcept(std::declval<node_t>().for_each(op))) {
 			auto guard = out_fence();
 			for (node_t* p = pop_head; p != pop_head->next; p = p->next) {
+				// pull the next node in while this one is processed, the chain
+				// walk is otherwise a chain of data-dependent cold loads
+				if (p->next != nullptr) {
+					iris_prefetch(p->next);
+				}
+
 				p->for_each(op);
 			}
 		}
@@ -2079,7 +3085,11 @@ namespace iris {
 		template <typename operation_t>
 		void for_each(operation_t&& op) const noexcept(noexcept(std::declval<node_t>().for_each(op))) {
 			auto guard = out_fence();
-			for (node_t* p = pop_head; p != pop_head->next; p = p->next) {
+			for (const node_t* p = pop_head; p != pop_head->next; p = p->next) {
+				if (p->next != nullptr) {
+					iris_prefetch(p->next);
+				}
+
 				p->for_each(op);
 			}
 		}
@@ -2142,7 +3152,7 @@ namespace iris {
 						n = t;
 						sub = t->begin_index();
 					} else {
-						return iterator(n, node_t::step_counter(n->begin_index(), count));
+						return iterator(n, node_t::step_counter(sub, count));
 					}
 				}
 			}
@@ -2186,6 +3196,11 @@ namespace iris {
 						return false;
 					}
 
+					// overlap the walk to the node after next with this node's work
+					if (n->next != nullptr) {
+						iris_prefetch(n->next);
+					}
+
 					current_node = n;
 					it = n->begin_index();
 				}
@@ -2244,7 +3259,7 @@ namespace iris {
 						n = t;
 						sub = t->begin_index();
 					} else {
-						return const_iterator(n, node_t::step_counter(n->begin_index(), count));
+						return const_iterator(n, node_t::step_counter(sub, count));
 					}
 				}
 			}
@@ -2288,6 +3303,11 @@ namespace iris {
 						return false;
 					}
 
+					// overlap the walk to the node after next with this node's work
+					if (n->next != nullptr) {
+						iris_prefetch(n->next);
+					}
+
 					current_node = n;
 					it = n->begin_index();
 				}
@@ -2330,10 +3350,94 @@ namespace iris {
 			return const_iterator(p, p->end_index());
 		}
 
+	protected:
+		// writer side of epoch mode: publish the current head/tail through
+		// atomics after every mutation, readers take acquire snapshots
+		void publish_heads(std::true_type) noexcept {
+			epoch_state.published_pop_head.store(pop_head, std::memory_order_release);
+			epoch_state.published_push_head.store(push_head, std::memory_order_release);
+		}
+
+		void publish_heads(std::false_type) noexcept {}
+
+		void publish_heads() noexcept {
+			publish_heads(std::integral_constant<bool, enable_epoch>());
+		}
+
+		// take the next node for growing: a reserved spare is activated in
+		// place, otherwise a fresh node (plus growth_factor - 1 spares) is
+		// chained at the tail. push_head itself advances in the caller after
+		// the node's content is written.
+		node_t* acquire_grow_node() {
+			node_t* p = push_head->next;
+			if (p != nullptr) {
+				// activate the reserved spare at the current counter
+				p->reset(iterator_counter);
+			} else {
+				p = node_allocator_t::allocate(1);
+				new (p) node_t(static_cast<node_allocator_t&>(*this), iterator_counter);
+				push_head->next = p;
+
+				// pre-chain extra spares per growth policy
+				node_t* q = p;
+				for (size_t i = 1; i < growth_factor; i++) {
+					node_t* spare = node_allocator_t::allocate(1);
+					new (spare) node_t(static_cast<node_allocator_t&>(*this), 0);
+					q->next = spare;
+					q = spare;
+				}
+			}
+
+			iterator_counter = node_t::step_counter(iterator_counter, element_count);
+			return p;
+		}
+
+		void release_node(node_t* p, std::false_type) noexcept {
+			p->~node_t();
+			node_allocator_t::deallocate(p, 1);
+		}
+
+		void release_node(node_t* p, std::true_type) noexcept {
+			// the node's next link stays intact so pinned readers can keep
+			// walking through it into the live chain
+			size_t epoch = epoch_state.domain.current();
+			epoch_state.retired[epoch % 3].emplace_back(p);
+
+			if (epoch_state.domain.try_advance()) {
+				// two-epoch-old retirements have no readers left
+				std::vector<node_t*>& stale = epoch_state.retired[(epoch_state.domain.current() + 1) % 3];
+				for (size_t i = 0; i < stale.size(); i++) {
+					stale[i]->~node_t();
+					node_allocator_t::deallocate(stale[i], 1);
+				}
+
+				stale.clear();
+			}
+		}
+
+		template <bool enabled>
+		typename std::enable_if<enabled>::type clear_retired() noexcept {
+			for (size_t k = 0; k < 3; k++) {
+				std::vector<node_t*>& stale = epoch_state.retired[k];
+				for (size_t i = 0; i < stale.size(); i++) {
+					stale[i]->~node_t();
+					node_allocator_t::deallocate(stale[i], 1);
+				}
+
+				stale.clear();
+			}
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled>::type clear_retired() noexcept {}
+
 	protected:
 		node_t* push_head = nullptr;
 		node_t* pop_head = nullptr; // pop_head is always prior to push_head.
 		size_t iterator_counter = 0;
+		size_t growth_factor = 1; // nodes added per overflow, see set_growth_factor
+		typename std::conditional<enable_counter, impl::queue_counter_enabled_t, impl::queue_counter_disabled_t>::type element_counter;
+		typename std::conditional<enable_epoch, impl::epoch_state_t<node_t>, impl::epoch_disabled_t>::type epoch_state;
 	};
 
 	// crtp-based resource handle reuse pool
@@ -2465,6 +3569,336 @@ namespace iris {
 		iris_queue_list_t<iterator, allocator_t> frames;
 	};
 
+	// vector with inline storage for the first inline_capacity elements,
+	// spilling to the heap only when it grows beyond that. covers the vector
+	// operations the iris containers rely on (including the iris_binary_*
+	// helpers), so small instances live entirely inside their owner.
+	template <typename element_t, size_t inline_capacity>
+	struct iris_small_vector_t {
+		using value_type = element_t;
+		using iterator = element_t*;
+		using const_iterator = const element_t*;
+
+		iris_small_vector_t() noexcept : count(0), limit(inline_capacity), heap_data(nullptr) {}
+
+		// allocator-compatibility constructor, the allocator is ignored
+		template <typename alloc_t>
+		explicit iris_small_vector_t(const alloc_t&) noexcept : iris_small_vector_t() {}
+
+		iris_small_vector_t(const iris_small_vector_t& rhs) : iris_small_vector_t() {
+			reserve(rhs.count);
+			for (size_t i = 0; i < rhs.count; i++) {
+				new (data() + i) element_t(rhs.data()[i]);
+			}
+
+			count = rhs.count;
+		}
+
+		iris_small_vector_t(iris_small_vector_t&& rhs) noexcept : iris_small_vector_t() {
+			*this = std::move(rhs);
+		}
+
+		iris_small_vector_t& operator = (const iris_small_vector_t& rhs) {
+			if (this != &rhs) {
+				clear();
+				reserve(rhs.count);
+				for (size_t i = 0; i < rhs.count; i++) {
+					new (data() + i) element_t(rhs.data()[i]);
+				}
+
+				count = rhs.count;
+			}
+
+			return *this;
+		}
+
+		iris_small_vector_t& operator = (iris_small_vector_t&& rhs) noexcept {
+			if (this != &rhs) {
+				clear();
+				if (rhs.heap_data != nullptr) {
+					// steal the heap buffer
+					heap_data = rhs.heap_data;
+					limit = rhs.limit;
+					count = rhs.count;
+					rhs.heap_data = nullptr;
+					rhs.limit = inline_capacity;
+					rhs.count = 0;
+				} else {
+					for (size_t i = 0; i < rhs.count; i++) {
+						new (data() + i) element_t(std::move(rhs.data()[i]));
+						rhs.data()[i].~element_t();
+					}
+
+					count = rhs.count;
+					rhs.count = 0;
+				}
+			}
+
+			return *this;
+		}
+
+		~iris_small_vector_t() noexcept {
+			clear();
+			if (heap_data != nullptr) {
+				free(heap_data);
+			}
+		}
+
+		element_t* data() noexcept {
+			return heap_data != nullptr ? heap_data : reinterpret_cast<element_t*>(inline_storage);
+		}
+
+		const element_t* data() const noexcept {
+			return heap_data != nullptr ? heap_data : reinterpret_cast<const element_t*>(inline_storage);
+		}
+
+		iterator begin() noexcept { return data(); }
+		iterator end() noexcept { return data() + count; }
+		const_iterator begin() const noexcept { return data(); }
+		const_iterator end() const noexcept { return data() + count; }
+
+		size_t size() const noexcept { return count; }
+		bool empty() const noexcept { return count == 0; }
+		size_t capacity() const noexcept { return limit; }
+
+		element_t& operator [] (size_t index) noexcept {
+			IRIS_ASSERT(index < count);
+			return data()[index];
+		}
+
+		const element_t& operator [] (size_t index) const noexcept {
+			IRIS_ASSERT(index < count);
+			return data()[index];
+		}
+
+		void reserve(size_t required) {
+			if (required > limit) {
+				size_t target = std::max(required, limit * 2);
+				element_t* storage = reinterpret_cast<element_t*>(malloc(target * sizeof(element_t)));
+				if (storage == nullptr) {
+					throw std::bad_alloc();
+				}
+
+				element_t* source = data();
+				for (size_t i = 0; i < count; i++) {
+					new (storage + i) element_t(std::move(source[i]));
+					source[i].~element_t();
+				}
+
+				if (heap_data != nullptr) {
+					free(heap_data);
+				}
+
+				heap_data = storage;
+				limit = target;
+			}
+		}
+
+		void resize(size_t n) {
+			if (n > count) {
+				reserve(n);
+				for (size_t i = count; i < n; i++) {
+					new (data() + i) element_t();
+				}
+			} else {
+				for (size_t i = n; i < count; i++) {
+					data()[i].~element_t();
+				}
+			}
+
+			count = n;
+		}
+
+		void clear() noexcept {
+			for (size_t i = 0; i < count; i++) {
+				data()[i].~element_t();
+			}
+
+			count = 0;
+		}
+
+		template <typename input_t>
+		void push_back(input_t&& value) {
+			reserve(count + 1);
+			new (data() + count) element_t(std::forward<input_t>(value));
+			count++;
+		}
+
+		template <typename... args_t>
+		void emplace_back(args_t&&... args) {
+			reserve(count + 1);
+			new (data() + count) element_t(std::forward<args_t>(args)...);
+			count++;
+		}
+
+		template <typename input_t>
+		iterator insert(iterator pos, input_t&& value) {
+			size_t offset = iris_verify_cast<size_t>(pos - begin());
+			reserve(count + 1);
+
+			element_t* p = data();
+			if (offset != count) {
+				new (p + count) element_t(std::move(p[count - 1]));
+				for (size_t i = count - 1; i > offset; i--) {
+					p[i] = std::move(p[i - 1]);
+				}
+
+				p[offset] = std::forward<input_t>(value);
+			} else {
+				new (p + offset) element_t(std::forward<input_t>(value));
+			}
+
+			count++;
+			return p + offset;
+		}
+
+		iterator erase(iterator pos) noexcept {
+			IRIS_ASSERT(pos != end());
+			element_t* p = data();
+			size_t offset = iris_verify_cast<size_t>(pos - p);
+			for (size_t i = offset; i + 1 < count; i++) {
+				p[i] = std::move(p[i + 1]);
+			}
+
+			p[--count].~element_t();
+			return p + offset;
+		}
+
+	protected:
+		size_t count;
+		size_t limit;
+		element_t* heap_data; // nullptr while inline
+		alignas(alignof(element_t)) uint8_t inline_storage[sizeof(element_t) * inline_capacity];
+	};
+
+	// move-only callable wrapper with fixed inline storage, for task queues whose
+	// callables should stay away from the allocator. callables that fit within
+	// inline_size bytes are stored in place, larger ones fall back to a single
+	// heap allocation. can be used as the func_t parameter of iris_warp_t.
+	template <typename signature_t, size_t inline_size = sizeof(void*) * 8>
+	struct iris_inline_function_t;
+
+	template <typename return_t, typename... args_t, size_t inline_size>
+	struct iris_inline_function_t<return_t(args_t...), inline_size> {
+		iris_inline_function_t() noexcept : invoke_proc(nullptr), manage_proc(nullptr) {}
+
+		template <typename callable_t, typename = typename std::enable_if<!std::is_same<typename std::decay<callable_t>::type, iris_inline_function_t>::value>::type>
+		iris_inline_function_t(callable_t&& callable) {
+			init(std::forward<callable_t>(callable), std::integral_constant<bool, fits<typename std::decay<callable_t>::type>::value>());
+		}
+
+		iris_inline_function_t(const iris_inline_function_t& rhs) = delete;
+		iris_inline_function_t& operator = (const iris_inline_function_t& rhs) = delete;
+
+		iris_inline_function_t(iris_inline_function_t&& rhs) noexcept : invoke_proc(rhs.invoke_proc), manage_proc(rhs.manage_proc) {
+			if (manage_proc != nullptr) {
+				manage_proc(manage_operation_t::move, &storage, &rhs.storage);
+			}
+
+			rhs.invoke_proc = nullptr;
+			rhs.manage_proc = nullptr;
+		}
+
+		iris_inline_function_t& operator = (iris_inline_function_t&& rhs) noexcept {
+			if (this != &rhs) {
+				clear();
+				invoke_proc = rhs.invoke_proc;
+				manage_proc = rhs.manage_proc;
+				if (manage_proc != nullptr) {
+					manage_proc(manage_operation_t::move, &storage, &rhs.storage);
+				}
+
+				rhs.invoke_proc = nullptr;
+				rhs.manage_proc = nullptr;
+			}
+
+			return *this;
+		}
+
+		~iris_inline_function_t() noexcept {
+			clear();
+		}
+
+		return_t operator () (args_t... args) const {
+			IRIS_ASSERT(invoke_proc != nullptr);
+			return invoke_proc(const_cast<void*>(static_cast<const void*>(&storage)), std::forward<args_t>(args)...);
+		}
+
+		explicit operator bool() const noexcept {
+			return invoke_proc != nullptr;
+		}
+
+	protected:
+		enum class manage_operation_t : size_t {
+			move, destroy
+		};
+
+		struct alignas(sizeof(void*)) storage_t {
+			uint8_t data[inline_size];
+		};
+
+		template <typename callable_t>
+		struct fits : std::integral_constant<bool, sizeof(callable_t) <= inline_size && alignof(callable_t) <= alignof(storage_t)> {};
+
+		template <typename callable_t>
+		static return_t invoke_inline(void* target, args_t... args) {
+			return (*reinterpret_cast<callable_t*>(target))(std::forward<args_t>(args)...);
+		}
+
+		template <typename callable_t>
+		static return_t invoke_heap(void* target, args_t... args) {
+			return (**reinterpret_cast<callable_t**>(target))(std::forward<args_t>(args)...);
+		}
+
+		template <typename callable_t>
+		static void manage_inline(manage_operation_t operation, void* target, void* source) noexcept {
+			if (operation == manage_operation_t::move) {
+				new (target) callable_t(std::move(*reinterpret_cast<callable_t*>(source)));
+				reinterpret_cast<callable_t*>(source)->~callable_t();
+			} else {
+				reinterpret_cast<callable_t*>(target)->~callable_t();
+			}
+		}
+
+		template <typename callable_t>
+		static void manage_heap(manage_operation_t operation, void* target, void* source) noexcept {
+			if (operation == manage_operation_t::move) {
+				*reinterpret_cast<callable_t**>(target) = *reinterpret_cast<callable_t**>(source);
+				*reinterpret_cast<callable_t**>(source) = nullptr;
+			} else {
+				delete *reinterpret_cast<callable_t**>(target);
+			}
+		}
+
+		template <typename callable_t>
+		void init(callable_t&& callable, std::true_type) {
+			using decayed_t = typename std::decay<callable_t>::type;
+			new (&storage) decayed_t(std::forward<callable_t>(callable));
+			invoke_proc = &invoke_inline<decayed_t>;
+			manage_proc = &manage_inline<decayed_t>;
+		}
+
+		template <typename callable_t>
+		void init(callable_t&& callable, std::false_type) {
+			using decayed_t = typename std::decay<callable_t>::type;
+			*reinterpret_cast<decayed_t**>(&storage) = new decayed_t(std::forward<callable_t>(callable));
+			invoke_proc = &invoke_heap<decayed_t>;
+			manage_proc = &manage_heap<decayed_t>;
+		}
+
+		void clear() noexcept {
+			if (manage_proc != nullptr) {
+				manage_proc(manage_operation_t::destroy, &storage, nullptr);
+				manage_proc = nullptr;
+				invoke_proc = nullptr;
+			}
+		}
+
+		return_t (*invoke_proc)(void*, args_t...);
+		void (*manage_proc)(manage_operation_t, void*, void*);
+		storage_t storage;
+	};
+
 	template <typename quantity_t, size_t n>
 	struct iris_quota_t {
 		using amount_t = std::array<quantity_t, n>;
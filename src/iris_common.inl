@@ -57,11 +57,35 @@ SOFTWARE.
 
 namespace iris {
 	static constexpr size_t large_page = 64 * 1024;
+	static constexpr size_t huge_page = 2 * 1024 * 1024;
+
+#ifndef IRIS_USE_HUGE_PAGES
+#define IRIS_USE_HUGE_PAGES 0
+#endif
+
+	static bool iris_huge_pages_enabled = IRIS_USE_HUGE_PAGES != 0;
+
+	IRIS_SHARED_LIBRARY_DECORATOR void iris_set_huge_pages_enabled(bool enabled) noexcept {
+		iris_huge_pages_enabled = enabled;
+	}
+
+	IRIS_SHARED_LIBRARY_DECORATOR bool iris_get_huge_pages_enabled() noexcept {
+		return iris_huge_pages_enabled;
+	}
+
 	IRIS_SHARED_LIBRARY_DECORATOR void* iris_alloc_aligned(size_t size, size_t alignment) {
 #ifdef _WIN32
 		// 64k page, use low-level allocation
 		if (size >= large_page && ((size & (large_page - 1)) == 0)) {
 			IRIS_ASSERT(alignment <= large_page);
+			if (iris_huge_pages_enabled && size >= huge_page && ((size & (huge_page - 1)) == 0)) {
+				// large pages require SeLockMemoryPrivilege, fall back transparently
+				void* data = ::VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+				if (data != nullptr) {
+					return data;
+				}
+			}
+
 			// usually, VirtualAlloc allocates memory in page with 64k
 			return ::VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_READWRITE);
 		} else {
@@ -70,6 +94,25 @@ namespace iris {
 #else
 		if (size >= large_page && ((size & (large_page - 1)) == 0)) {
 			IRIS_ASSERT(alignment <= large_page);
+			if (iris_huge_pages_enabled && size >= huge_page && ((size & (huge_page - 1)) == 0)) {
+#ifdef MAP_HUGETLB
+				// explicit huge pages first, fall back transparently when the
+				// system has none reserved
+				void* data = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+				if (data != MAP_FAILED) {
+					return data;
+				}
+#endif
+				void* fallback = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+				if (fallback != MAP_FAILED) {
+					// ask for transparent huge pages instead
+					madvise(fallback, size, MADV_HUGEPAGE);
+				}
+#endif
+				return fallback;
+			}
+
 			// mmap also aligns at 64k without any gaps between pages in most of implementations
 			return mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 		} else {
@@ -54,7 +54,11 @@ namespace iris {
 			// currently we do not handle unexcepted exceptions
 			void unhandled_exception() noexcept { return std::terminate(); }
 
-			std::function<void(return_t&&)> completion;
+			// the completion record lives inline in the coroutine frame: the
+			// bridging closures (e.g. the lua resume contexts, a few pointers
+			// each) no longer exercise the allocator once per yield/resume pair
+			// the way the std::function small-buffer miss did
+			iris_inline_function_t<void(return_t&&)> completion;
 		};
 
 		template <>
@@ -69,7 +73,7 @@ namespace iris {
 			}
 
 			void unhandled_exception() noexcept { return std::terminate(); }
-			std::function<void()> completion;
+			iris_inline_function_t<void()> completion;
 		};
 	}
 
@@ -176,11 +180,23 @@ namespace iris {
 		static constexpr size_t status_mask_waited = 1u << 1u;
 		static constexpr size_t status_mask_completed = 1u << 2u;
 
+		// tag with a cancellation token: if the token fired by the time the
+		// routine would run, func is skipped and the awaiting coroutine resumes
+		// with a default result; query is_cancelled() after co_await.
+		iris_awaitable_t& set_cancellation(const iris_cancellation_token_t* t) noexcept {
+			token = t;
+			return *this;
+		}
+
+		bool is_cancelled() const noexcept {
+			return token != nullptr && token->is_cancelled();
+		}
+
 		// constructed from a given target warp and routine function
 		// notice that we do not initialize `caller` here, let `await_suspend` do
 		// parallel_priority: ~size_t(0) means no parallization, other value indicates the dispatch priority of parallel routines
 		template <typename callable_t>
-		iris_awaitable_t(warp_t* target_warp, callable_t&& f, size_t p) noexcept : caller(nullptr), target(target_warp), parallel_priority(p), func(std::forward<callable_t>(f)), resume_handle(std::coroutine_handle()) {
+		iris_awaitable_t(warp_t* target_warp, callable_t&& f, size_t p) noexcept : caller(nullptr), target(target_warp), parallel_priority(p), token(nullptr), func(std::forward<callable_t>(f)), resume_handle(std::coroutine_handle()) {
 			IRIS_ASSERT(target_warp != nullptr || parallel_priority == ~size_t(0));
 			if constexpr (!std::is_void_v<return_t>) {
 				ret = return_t();
@@ -210,10 +226,12 @@ namespace iris {
 			// the same warp, execute at once!
 			// even they are both null
 			if (target == caller) {
-				if constexpr (std::is_void_v<return_t>) {
-					func();
-				} else {
-					ret = func(); // auto moved here
+				if (!is_cancelled()) {
+					if constexpr (std::is_void_v<return_t>) {
+						func();
+					} else {
+						ret = func(); // auto moved here
+					}
 				}
 
 				status.fetch_or(status_mask_completed, std::memory_order_release);
@@ -224,10 +242,12 @@ namespace iris {
 				if (target == nullptr) {
 					// targeting to thread pool with no warp context
 					caller->get_async_worker().queue([this]() mutable {
-						if constexpr (std::is_void_v<return_t>) {
-							func();
-						} else {
-							ret = func();
+						if (!is_cancelled()) {
+							if constexpr (std::is_void_v<return_t>) {
+								func();
+							} else {
+								ret = func();
+							}
 						}
 
 						if (status.fetch_or(status_mask_completed, std::memory_order_release) & status_mask_waited) {
@@ -239,10 +259,12 @@ namespace iris {
 						// targeting to a valid warp
 						// prepare callback first
 						auto callback = [this]() mutable noexcept(noexcept(func()) && noexcept(std::declval<iris_awaitable_t>().resume_one())) {
-							if constexpr (std::is_void_v<return_t>) {
-								func();
-							} else {
-								ret = func();
+							if (!is_cancelled()) {
+								if constexpr (std::is_void_v<return_t>) {
+									func();
+								} else {
+									ret = func();
+								}
 							}
 
 							if (status.fetch_or(status_mask_completed, std::memory_order_release) & status_mask_waited) {
@@ -259,10 +281,12 @@ namespace iris {
 						typename warp_t::suspend_guard_t guard(target);
 						target->get_async_worker().queue([this]() mutable noexcept(noexcept(func()) && noexcept(std::declval<iris_awaitable_t>().resume_one()) && noexcept(target->resume())) {
 							typename warp_t::suspend_guard_t guard(target);
-							if constexpr (std::is_void_v<return_t>) {
-								func();
-							} else {
-								ret = func();
+							if (!is_cancelled()) {
+								if constexpr (std::is_void_v<return_t>) {
+									func();
+								} else {
+									ret = func();
+								}
 							}
 
 							guard.cleanup();
@@ -303,6 +327,18 @@ namespace iris {
 
 			// return to caller's warp
 			if (caller != nullptr) {
+				// continuation stealing: when completing on a pool thread and the
+				// caller's warp can be preempted right now, resume the coroutine
+				// inline instead of round-tripping through the task queue, saving
+				// one scheduling hop per co_await
+				if (caller->get_async_worker().get_current_thread_index() != ~size_t(0)) {
+					typename warp_t::preempt_guard_t preempt_guard(*caller, 0);
+					if (preempt_guard) {
+						std::exchange(resume_handle, std::coroutine_handle()).resume();
+						return;
+					}
+				}
+
 				// notice that the condition `caller != target` holds
 				// so we can use `post` to skip self-queueing check
 				caller->queue_routine_post([handle = std::exchange(resume_handle, std::coroutine_handle())]() mutable noexcept(noexcept(resume_handle.resume())) {\
@@ -323,6 +359,7 @@ namespace iris {
 		warp_t* caller;
 		warp_t* target;
 		size_t parallel_priority;
+		const iris_cancellation_token_t* token;
 		func_t func;
 		std::coroutine_handle<> resume_handle;
 		std::conditional_t<std::is_void_v<return_t>, void_t, return_t> ret;
@@ -341,6 +378,361 @@ namespace iris {
 		return iris_awaitable_t<warp_t, std::decay_t<iris_func_t>>(target_warp, std::forward<iris_func_t>(func), priority);
 	}
 
+	namespace impl {
+		struct when_void_t {};
+
+		template <typename type_t>
+		using when_storage_t = std::conditional_t<std::is_void_v<type_t>, when_void_t, type_t>;
+	}
+
+	// await several functions dispatched concurrently over the pool: all
+	// sub-task state lives inside this single awaitable (no per-task frames)
+	// and the caller resumes once via one atomic countdown, receiving a tuple
+	// with every result (void results appear as placeholders).
+	template <typename warp_t, typename... funcs_t>
+	struct iris_when_all_t {
+		using async_worker_t = typename warp_t::async_worker_t;
+		using results_t = std::tuple<impl::when_storage_t<std::invoke_result_t<funcs_t>>...>;
+
+		template <typename... input_t>
+		iris_when_all_t(async_worker_t& worker, input_t&&... f) : async_worker(worker), caller(nullptr), funcs(std::forward<input_t>(f)...) {
+			pending.store(sizeof...(funcs_t), std::memory_order_relaxed);
+		}
+
+		constexpr bool await_ready() const noexcept {
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			resume_handle = std::move(handle);
+			caller = warp_t::get_current_warp();
+			dispatch_all(iris_make_sequence<sizeof...(funcs_t)>());
+		}
+
+		results_t await_resume() noexcept {
+			return std::move(results);
+		}
+
+	protected:
+		template <size_t... i>
+		void dispatch_all(iris_sequence<i...>) {
+			dummy_spread((async_worker.queue([this]() { run_one<i>(); }), 0)...);
+		}
+
+		static void dummy_spread(...) {}
+
+		template <size_t i>
+		void run_one() {
+			if constexpr (std::is_void_v<std::invoke_result_t<std::tuple_element_t<i, std::tuple<funcs_t...>>>>) {
+				std::get<i>(funcs)();
+			} else {
+				std::get<i>(results) = std::get<i>(funcs)();
+			}
+
+			if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				// all completed, resume through the caller's warp, or re-queue to
+				// avoid blocking the completing task
+				if (caller != nullptr) {
+					caller->queue_routine_post([handle = std::exchange(resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+				} else {
+					async_worker.queue([handle = std::exchange(resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+				}
+			}
+		}
+
+	protected:
+		async_worker_t& async_worker;
+		warp_t* caller;
+		std::atomic<size_t> pending;
+		std::coroutine_handle<> resume_handle;
+		std::tuple<funcs_t...> funcs;
+		results_t results;
+	};
+
+	template <typename warp_t, typename... funcs_t>
+	auto iris_when_all(typename warp_t::async_worker_t& worker, funcs_t&&... funcs) {
+		return iris_when_all_t<warp_t, std::decay_t<funcs_t>...>(worker, std::forward<funcs_t>(funcs)...);
+	}
+
+	// await the first of several functions to complete: resumes once with
+	// (index, result) of the winner while the losers keep running detached.
+	// exactly one heap allocation holds the shared state, released when the
+	// last task finishes. all functions must return the same type.
+	template <typename warp_t, typename result_t, typename... funcs_t>
+	struct iris_when_any_t {
+		using async_worker_t = typename warp_t::async_worker_t;
+		using storage_t = impl::when_storage_t<result_t>;
+
+		template <typename... input_t>
+		iris_when_any_t(async_worker_t& worker, input_t&&... f) : async_worker(worker), state(nullptr), funcs(std::forward<input_t>(f)...) {}
+
+		constexpr bool await_ready() const noexcept {
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			state = new state_t();
+			state->winner.store(0, std::memory_order_relaxed);
+			// tasks plus the awaiting coroutine itself keep the state alive
+			state->alive.store(sizeof...(funcs_t) + 1, std::memory_order_relaxed);
+			state->index = 0;
+			state->resume_handle = std::move(handle);
+			state->caller = warp_t::get_current_warp();
+			state->worker = &async_worker;
+			dispatch_all(iris_make_sequence<sizeof...(funcs_t)>());
+		}
+
+		std::pair<size_t, storage_t> await_resume() noexcept {
+			std::pair<size_t, storage_t> ret = std::make_pair(state->index, std::move(state->result));
+			if (state->alive.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				delete state;
+			}
+
+			return ret;
+		}
+
+	protected:
+		struct state_t {
+			std::atomic<size_t> winner;
+			std::atomic<size_t> alive;
+			size_t index;
+			storage_t result;
+			std::coroutine_handle<> resume_handle;
+			warp_t* caller;
+			async_worker_t* worker;
+		};
+
+		template <size_t... i>
+		void dispatch_all(iris_sequence<i...>) {
+			dummy_spread((async_worker.queue([s = state, func = std::move(std::get<i>(funcs))]() mutable { run_one<i>(s, func); }), 0)...);
+		}
+
+		static void dummy_spread(...) {}
+
+		template <size_t i, typename func_t>
+		static void run_one(state_t* state, func_t& func) {
+			storage_t result;
+			if constexpr (std::is_void_v<result_t>) {
+				func();
+			} else {
+				result = func();
+			}
+
+			if (state->winner.exchange(1, std::memory_order_acq_rel) == 0) {
+				state->index = i;
+				state->result = std::move(result);
+
+				// resume through the caller's warp, or re-queue to avoid
+				// blocking the completing task
+				if (state->caller != nullptr) {
+					state->caller->queue_routine_post([handle = std::exchange(state->resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+				} else {
+					state->worker->queue([handle = std::exchange(state->resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+				}
+			}
+
+			if (state->alive.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				delete state;
+			}
+		}
+
+	protected:
+		async_worker_t& async_worker;
+		state_t* state;
+		std::tuple<funcs_t...> funcs;
+	};
+
+	template <typename warp_t, typename first_func_t, typename... funcs_t>
+	auto iris_when_any(typename warp_t::async_worker_t& worker, first_func_t&& first, funcs_t&&... funcs) {
+		using result_t = std::invoke_result_t<std::decay_t<first_func_t>>;
+		static_assert((std::is_same_v<result_t, std::invoke_result_t<std::decay_t<funcs_t>>> && ...), "all functions of iris_when_any must return the same type");
+		return iris_when_any_t<warp_t, result_t, std::decay_t<first_func_t>, std::decay_t<funcs_t>...>(worker, std::forward<first_func_t>(first), std::forward<funcs_t>(funcs)...);
+	}
+
+	// run a known-blocking function on a dedicated blocking sub-pool worker and
+	// resume the awaiting coroutine back on its warp, so legacy blocking calls
+	// stop parking main pool threads. see also
+	// iris_async_worker_t::blocking_guard_t for calls that cannot be shunted.
+	template <typename warp_t, typename blocking_worker_t, typename func_t>
+	struct iris_blocking_t {
+		using return_t = std::invoke_result_t<func_t>;
+
+		template <typename callable_t>
+		iris_blocking_t(blocking_worker_t& w, callable_t&& f) : blocking_worker(w), func(std::forward<callable_t>(f)), caller(nullptr) {}
+
+		constexpr bool await_ready() const noexcept {
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			resume_handle = std::move(handle);
+			caller = warp_t::get_current_warp();
+
+			blocking_worker.queue([this]() {
+				if constexpr (std::is_void_v<return_t>) {
+					func();
+				} else {
+					ret = func();
+				}
+
+				if (caller != nullptr) {
+					caller->queue_routine_post([handle = std::exchange(resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+				} else {
+					// no warp to return to, continue on the blocking pool thread
+					std::exchange(resume_handle, std::coroutine_handle<>()).resume();
+				}
+			});
+		}
+
+		return_t await_resume() noexcept {
+			if constexpr (!std::is_void_v<return_t>) {
+				return std::move(ret);
+			}
+		}
+
+	protected:
+		struct void_t {};
+		blocking_worker_t& blocking_worker;
+		func_t func;
+		warp_t* caller;
+		std::coroutine_handle<> resume_handle;
+		std::conditional_t<std::is_void_v<return_t>, void_t, return_t> ret;
+	};
+
+	template <typename warp_t, typename blocking_worker_t, typename func_t>
+	auto iris_blocking(blocking_worker_t& blocking_worker, func_t&& func) {
+		return iris_blocking_t<warp_t, blocking_worker_t, std::decay_t<func_t>>(blocking_worker, std::forward<func_t>(func));
+	}
+
+	// producer throttling: co_await suspends the producing coroutine until the
+	// target warp's pending depth drains below low_water, then resumes on the
+	// producer's own warp. the drain probe rides the worker queue behind the
+	// backlog it waits for, so it self-throttles instead of spinning.
+	template <typename warp_t>
+	struct iris_backpressure_t {
+		iris_backpressure_t(warp_t& w, size_t low) noexcept : target(w), low_water(low), caller(nullptr) {}
+
+		bool await_ready() const noexcept {
+			return target.get_pending_task_count() <= low_water;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			resume_handle = std::move(handle);
+			caller = warp_t::get_current_warp();
+			target.get_async_worker().queue(probe_t{ this });
+		}
+
+		constexpr void await_resume() const noexcept {}
+
+	protected:
+		struct probe_t {
+			void operator () () {
+				iris_backpressure_t* self = host;
+				if (self->target.get_pending_task_count() <= self->low_water) {
+					if (self->caller != nullptr) {
+						self->caller->queue_routine_post([handle = std::exchange(self->resume_handle, std::coroutine_handle<>())]() mutable {
+							handle.resume();
+						});
+					} else {
+						std::exchange(self->resume_handle, std::coroutine_handle<>()).resume();
+					}
+				} else {
+					// still saturated, fall back in behind the backlog
+					self->target.get_async_worker().queue(probe_t{ self });
+				}
+			}
+
+			iris_backpressure_t* host;
+		};
+
+		warp_t& target;
+		size_t low_water;
+		warp_t* caller;
+		std::coroutine_handle<> resume_handle;
+	};
+
+	template <typename warp_t>
+	auto iris_backpressure(warp_t& warp, size_t low_water) noexcept {
+		return iris_backpressure_t<warp_t>(warp, low_water);
+	}
+
+	// co_await a delay armed on an iris_timer_wheel_t; resumes on the awaiting
+	// warp once expired. cancel() disarms a pending delay and resumes the
+	// coroutine immediately, in which case await_resume returns false.
+	template <typename warp_t, typename timer_wheel_t>
+	struct iris_delay_t {
+		iris_delay_t(timer_wheel_t& w, size_t ms) noexcept : wheel(w), delay_milliseconds(ms), warp(nullptr), cancelled(false) {}
+
+		constexpr bool await_ready() const noexcept {
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle) {
+			resume_handle = std::move(handle);
+			if constexpr (!std::is_same_v<warp_t, void>) {
+				warp = warp_t::get_current_warp();
+			}
+
+			timer_handle = wheel.arm(delay_milliseconds, [this]() { resume(); });
+		}
+
+		bool await_resume() const noexcept {
+			return !cancelled;
+		}
+
+		// cancel a pending delay, resuming the awaiting coroutine right away.
+		// returns false when the timer already fired (or was never armed).
+		bool cancel() {
+			if (wheel.cancel(timer_handle)) {
+				cancelled = true;
+				resume();
+				return true;
+			}
+
+			return false;
+		}
+
+	protected:
+		void resume() {
+			if constexpr (!std::is_same_v<warp_t, void>) {
+				if (warp != nullptr) {
+					warp->queue_routine_post([handle = std::exchange(resume_handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+
+					return;
+				}
+			}
+
+			wheel.get_async_worker().queue([handle = std::exchange(resume_handle, std::coroutine_handle<>())]() mutable {
+				handle.resume();
+			});
+		}
+
+	protected:
+		timer_wheel_t& wheel;
+		size_t delay_milliseconds;
+		typename timer_wheel_t::handle_t timer_handle;
+		std::coroutine_handle<> resume_handle;
+		warp_t* warp;
+		bool cancelled;
+	};
+
+	template <typename warp_t, typename timer_wheel_t>
+	auto iris_delay(timer_wheel_t& wheel, size_t milliseconds) noexcept {
+		return iris_delay_t<warp_t, timer_wheel_t>(wheel, milliseconds);
+	}
+
 	// switch to specified warp or warp pair, and return the original current warp
 	template <typename warp_t>
 	struct iris_switch_t {
@@ -532,6 +924,61 @@ namespace iris {
 			}
 		}
 
+		// dispatch a whole batch of resumptions at once: warpless handles are
+		// linked into one task chain published with a single atomic splice and
+		// one notification, and handles sharing a target warp are resumed in
+		// sequence from one queued routine, so notifying hundreds of waiters
+		// stops storming the scheduler with individual queue calls.
+		template <typename container_t>
+		void dispatch_batch(container_t&& infos) {
+			typename async_worker_t::task_base_t* head = nullptr;
+			typename async_worker_t::task_base_t* tail = nullptr;
+
+			for (size_t i = 0; i < infos.size(); i++) {
+				info_t& info = infos[i];
+				if (info.handle == std::coroutine_handle<>()) {
+					continue;
+				}
+
+				warp_t* target = nullptr;
+				if constexpr (!std::is_same_v<warp_t, void>) {
+					target = info.warp;
+				}
+
+				if (target == nullptr) {
+					auto* task = async_worker.new_task([handle = std::exchange(info.handle, std::coroutine_handle<>())]() mutable {
+						handle.resume();
+					});
+
+					if (head == nullptr) {
+						head = tail = task;
+					} else {
+						tail->next = task;
+						tail = task;
+					}
+				} else if constexpr (!std::is_same_v<warp_t, void>) {
+					// gather every waiter of this warp, one routine resumes them in order
+					std::vector<std::coroutine_handle<>> handles;
+					handles.emplace_back(std::exchange(info.handle, std::coroutine_handle<>()));
+					for (size_t k = i + 1; k < infos.size(); k++) {
+						if (infos[k].warp == target && infos[k].handle != std::coroutine_handle<>()) {
+							handles.emplace_back(std::exchange(infos[k].handle, std::coroutine_handle<>()));
+						}
+					}
+
+					target->queue_routine_post([handles = std::move(handles)]() mutable {
+						for (size_t k = 0; k < handles.size(); k++) {
+							handles[k].resume();
+						}
+					});
+				}
+			}
+
+			if (head != nullptr) {
+				async_worker.queue_task_batch(head, tail, 0);
+			}
+		}
+
 		async_worker_t& async_worker;
 	};
 
@@ -573,7 +1020,7 @@ namespace iris {
 			signaled.store(0, std::memory_order_release);
 		}
 
-		// notify all waiting coroutines
+		// notify all waiting coroutines, resumptions are submitted as one batch
 		void notify() {
 			std::vector<info_t> set_handles;
 			do {
@@ -583,9 +1030,7 @@ namespace iris {
 				std::swap(set_handles, handles);
 			} while (false);
 
-			for (auto&& info : set_handles) {
-				iris_sync_t<warp_t, async_worker_t>::dispatch(std::move(info));
-			}
+			iris_sync_t<warp_t, async_worker_t>::dispatch_batch(set_handles);
 		}
 
 	protected:
@@ -773,6 +1218,341 @@ namespace iris {
 		iris_queue_list_t<element_t> elements;
 	};
 
+	// buffered awaitable channel with backpressure (mpmc)
+	// co_await push() suspends while the channel is full, co_await pop()
+	// suspends while it is empty; resumptions are routed through the owning
+	// warp like the other iris_sync_t primitives.
+	template <typename element_t, typename warp_t, typename async_worker_t = typename warp_t::async_worker_t>
+	struct iris_channel_t : iris_sync_t<warp_t, async_worker_t> {
+		using info_t = typename iris_sync_t<warp_t, async_worker_t>::info_t;
+
+		iris_channel_t(async_worker_t& worker, size_t bound) : iris_sync_t<warp_t, async_worker_t>(worker), capacity(bound) {
+			IRIS_ASSERT(bound != 0);
+		}
+
+		struct push_awaitable_t {
+			push_awaitable_t(iris_channel_t& c, element_t&& v) noexcept : channel(c), value(std::move(v)) {}
+
+			bool await_ready() {
+				info_t consumer;
+				bool ready = channel.try_produce(value, consumer);
+				if (ready && consumer.handle != std::coroutine_handle<>()) {
+					channel.dispatch(std::move(consumer));
+				}
+
+				return ready;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle) {
+				std::unique_lock<std::mutex> guard(channel.lock);
+				// recheck under lock, a consumer may have arrived or drained the
+				// channel meanwhile
+				if (!channel.consumers.empty()) {
+					consumer_entry_t entry = std::move(channel.consumers.top());
+					channel.consumers.pop();
+					entry.awaitable->value = std::move(value);
+					guard.unlock();
+
+					channel.dispatch(std::move(entry.info));
+					return false; // resume immediately
+				}
+
+				if (channel.elements.size() < channel.capacity) {
+					channel.elements.push(std::move(value));
+					guard.unlock();
+					return false; // resume immediately
+				}
+
+				info_t info;
+				info.handle = std::move(handle);
+				if constexpr (!std::is_same_v<warp_t, void>) {
+					info.warp = warp_t::get_current_warp();
+				}
+
+				channel.producers.push(producer_entry_t{ std::move(info), this });
+				return true;
+			}
+
+			constexpr void await_resume() const noexcept {}
+
+			iris_channel_t& channel;
+			element_t value;
+		};
+
+		struct pop_awaitable_t {
+			pop_awaitable_t(iris_channel_t& c) noexcept : channel(c) {}
+
+			bool await_ready() {
+				info_t producer;
+				bool ready = channel.try_consume(value, producer);
+				if (ready && producer.handle != std::coroutine_handle<>()) {
+					channel.dispatch(std::move(producer));
+				}
+
+				return ready;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle) {
+				std::unique_lock<std::mutex> guard(channel.lock);
+				// recheck under lock, a producer may have refilled the channel meanwhile
+				if (!channel.elements.empty()) {
+					value = std::move(channel.elements.top());
+					channel.elements.pop();
+
+					if (!channel.producers.empty()) {
+						// promote a waiting producer into the freed slot
+						producer_entry_t entry = std::move(channel.producers.top());
+						channel.producers.pop();
+						channel.elements.push(std::move(entry.awaitable->value));
+						guard.unlock();
+
+						channel.dispatch(std::move(entry.info));
+					} else {
+						guard.unlock();
+					}
+
+					return false; // resume immediately
+				}
+
+				info_t info;
+				info.handle = std::move(handle);
+				if constexpr (!std::is_same_v<warp_t, void>) {
+					info.warp = warp_t::get_current_warp();
+				}
+
+				channel.consumers.push(consumer_entry_t{ std::move(info), this });
+				return true;
+			}
+
+			element_t await_resume() noexcept {
+				return std::move(value);
+			}
+
+			iris_channel_t& channel;
+			element_t value;
+		};
+
+		// awaitable push, suspends while the channel is full
+		push_awaitable_t push(element_t value) {
+			return push_awaitable_t(*this, std::move(value));
+		}
+
+		// awaitable pop, suspends while the channel is empty
+		pop_awaitable_t pop() {
+			return pop_awaitable_t(*this);
+		}
+
+		size_t size() const noexcept {
+			std::lock_guard<std::mutex> guard(lock);
+			return elements.size();
+		}
+
+	protected:
+		struct producer_entry_t {
+			info_t info;
+			push_awaitable_t* awaitable;
+		};
+
+		struct consumer_entry_t {
+			info_t info;
+			pop_awaitable_t* awaitable;
+		};
+
+		// places value either into a waiting consumer or into the buffer,
+		// returns false when the channel is full. consumer info to dispatch is
+		// returned so the caller can resume it outside the lock.
+		bool try_produce(element_t& value, info_t& consumer) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (!consumers.empty()) {
+				consumer_entry_t entry = std::move(consumers.top());
+				consumers.pop();
+				entry.awaitable->value = std::move(value);
+				consumer = std::move(entry.info);
+				return true;
+			}
+
+			if (elements.size() < capacity) {
+				elements.push(std::move(value));
+				return true;
+			}
+
+			return false;
+		}
+
+		// takes a value from the buffer, handing a waiting producer's value over
+		// to keep the buffer full, or returns false when nothing is available
+		bool try_consume(element_t& value, info_t& producer) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (!elements.empty()) {
+				value = std::move(elements.top());
+				elements.pop();
+
+				if (!producers.empty()) {
+					producer_entry_t entry = std::move(producers.top());
+					producers.pop();
+					elements.push(std::move(entry.awaitable->value));
+					producer = std::move(entry.info);
+				}
+
+				return true;
+			}
+
+			return false;
+		}
+
+	protected:
+		size_t capacity;
+		mutable std::mutex lock;
+		iris_queue_list_t<element_t> elements;
+		iris_queue_list_t<producer_entry_t> producers;
+		iris_queue_list_t<consumer_entry_t> consumers;
+	};
+
+	// awaitable read-write lock: co_await lock_shared()/lock_unique() suspend
+	// until the lock is grantable, writers take precedence over newly arriving
+	// readers, and releasing a writer wakes every queued reader in one resume
+	// batch. resumptions route through the waiter's warp like the other
+	// iris_sync_t primitives.
+	template <typename warp_t, typename async_worker_t = typename warp_t::async_worker_t>
+	struct iris_shared_lock_t : iris_sync_t<warp_t, async_worker_t> {
+		using info_t = typename iris_sync_t<warp_t, async_worker_t>::info_t;
+
+		iris_shared_lock_t(async_worker_t& worker) : iris_sync_t<warp_t, async_worker_t>(worker), reader_count(0), writer_active(false) {}
+
+		struct shared_awaitable_t {
+			shared_awaitable_t(iris_shared_lock_t& h) noexcept : host(h) {}
+
+			bool await_ready() {
+				std::lock_guard<std::mutex> guard(host.state_lock);
+				if (!host.writer_active && host.waiting_writers.empty()) {
+					host.reader_count++;
+					return true;
+				}
+
+				return false;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle) {
+				std::lock_guard<std::mutex> guard(host.state_lock);
+				// recheck under lock, the writer may have released meanwhile
+				if (!host.writer_active && host.waiting_writers.empty()) {
+					host.reader_count++;
+					return false; // resume immediately
+				}
+
+				host.waiting_readers.emplace_back(host.make_info(std::move(handle)));
+				return true;
+			}
+
+			constexpr void await_resume() const noexcept {}
+
+			iris_shared_lock_t& host;
+		};
+
+		struct unique_awaitable_t {
+			unique_awaitable_t(iris_shared_lock_t& h) noexcept : host(h) {}
+
+			bool await_ready() {
+				std::lock_guard<std::mutex> guard(host.state_lock);
+				if (!host.writer_active && host.reader_count == 0) {
+					host.writer_active = true;
+					return true;
+				}
+
+				return false;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle) {
+				std::lock_guard<std::mutex> guard(host.state_lock);
+				if (!host.writer_active && host.reader_count == 0) {
+					host.writer_active = true;
+					return false; // resume immediately
+				}
+
+				host.waiting_writers.emplace_back(host.make_info(std::move(handle)));
+				return true;
+			}
+
+			constexpr void await_resume() const noexcept {}
+
+			iris_shared_lock_t& host;
+		};
+
+		shared_awaitable_t lock_shared() noexcept {
+			return shared_awaitable_t(*this);
+		}
+
+		unique_awaitable_t lock_unique() noexcept {
+			return unique_awaitable_t(*this);
+		}
+
+		void unlock_shared() {
+			info_t writer;
+			bool wake_writer = false;
+			do {
+				std::lock_guard<std::mutex> guard(state_lock);
+				IRIS_ASSERT(reader_count != 0 && !writer_active);
+				if (--reader_count == 0 && !waiting_writers.empty()) {
+					writer_active = true;
+					writer = std::move(waiting_writers.front());
+					waiting_writers.erase(waiting_writers.begin());
+					wake_writer = true;
+				}
+			} while (false);
+
+			if (wake_writer) {
+				iris_sync_t<warp_t, async_worker_t>::dispatch(std::move(writer));
+			}
+		}
+
+		void unlock_unique() {
+			std::vector<info_t> readers;
+			info_t writer;
+			bool wake_writer = false;
+			do {
+				std::lock_guard<std::mutex> guard(state_lock);
+				IRIS_ASSERT(writer_active && reader_count == 0);
+				writer_active = false;
+
+				if (!waiting_writers.empty()) {
+					// hand over to the next writer directly
+					writer_active = true;
+					writer = std::move(waiting_writers.front());
+					waiting_writers.erase(waiting_writers.begin());
+					wake_writer = true;
+				} else if (!waiting_readers.empty()) {
+					// grant every queued reader at once, resumed as one batch
+					reader_count += waiting_readers.size();
+					std::swap(readers, waiting_readers);
+				}
+			} while (false);
+
+			if (wake_writer) {
+				iris_sync_t<warp_t, async_worker_t>::dispatch(std::move(writer));
+			} else if (!readers.empty()) {
+				iris_sync_t<warp_t, async_worker_t>::dispatch_batch(readers);
+			}
+		}
+
+	protected:
+		static info_t make_info(std::coroutine_handle<>&& handle) {
+			info_t info;
+			info.handle = std::move(handle);
+			if constexpr (!std::is_same_v<warp_t, void>) {
+				info.warp = warp_t::get_current_warp();
+			}
+
+			return info;
+		}
+
+	protected:
+		std::mutex state_lock;
+		size_t reader_count;
+		bool writer_active;
+		std::vector<info_t> waiting_readers;
+		std::vector<info_t> waiting_writers;
+	};
+
 	// barrier-like multiple coroutine sychronization
 	template <typename warp_t, typename value_t = bool, typename async_worker_t = typename warp_t::async_worker_t>
 	struct iris_barrier_t : iris_sync_t<warp_t, async_worker_t> {
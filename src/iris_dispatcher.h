@@ -35,6 +35,25 @@ SOFTWARE.
 #include <mutex>
 #include <thread>
 #include <condition_variable>
+#include <chrono>
+
+// define IRIS_ENABLE_STATS to compile in per-warp scheduling counters,
+// aggregated on demand via iris_warp_t::get_stats(). zero overhead when off.
+#ifndef IRIS_ENABLE_STATS
+#define IRIS_ENABLE_STATS 0
+#endif
+
+// define IRIS_ENABLE_REPLAY to compile in deterministic record/replay of
+// worker scheduling decisions, see iris_async_worker_t::record()/replay().
+#ifndef IRIS_ENABLE_REPLAY
+#define IRIS_ENABLE_REPLAY 0
+#endif
+
+// define IRIS_DEBUG_FALSE_SHARING to assert at warp initialization that hot
+// per-thread scheduling fields do not share cache lines.
+#ifndef IRIS_DEBUG_FALSE_SHARING
+#define IRIS_DEBUG_FALSE_SHARING 0
+#endif
 
 namespace iris {
 	namespace impl {	
@@ -65,8 +84,119 @@ namespace iris {
 		private:
 			std::atomic<size_t>* variable;
 		};
+
+		// bounded work-stealing deque, lifo for the owner thread and fifo for thieves.
+		// adapted from the chase-lev algorithm with a fixed-size ring, on overflow the
+		// caller is expected to fall back to the shared queue.
+		template <typename task_t, size_t capacity = 256>
+		struct task_deque_t {
+			task_deque_t() noexcept {
+				top_count.store(0, std::memory_order_relaxed);
+				bottom_count.store(0, std::memory_order_relaxed);
+				for (size_t i = 0; i < capacity; i++) {
+					ring_buffer[i].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+
+			// push a task at bottom, must be called from the owner thread only.
+			// returns false if the deque is full.
+			bool push(task_t* task) noexcept {
+				size_t bottom = bottom_count.load(std::memory_order_relaxed);
+				size_t top = top_count.load(std::memory_order_acquire);
+
+				if (bottom - top >= capacity) {
+					return false; // full
+				}
+
+				ring_buffer[bottom % capacity].store(task, std::memory_order_relaxed);
+				bottom_count.store(bottom + 1, std::memory_order_release);
+				return true;
+			}
+
+			// pop a task from bottom (lifo), must be called from the owner thread only.
+			task_t* pop() noexcept {
+				size_t bottom = bottom_count.load(std::memory_order_relaxed);
+				if (bottom == top_count.load(std::memory_order_relaxed)) {
+					return nullptr; // fast path for empty deque
+				}
+
+				bottom--;
+				bottom_count.store(bottom, std::memory_order_relaxed);
+				// the fence makes the decrement of bottom_count visible to concurrent steal()
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				size_t top = top_count.load(std::memory_order_relaxed);
+
+				if (static_cast<ptrdiff_t>(bottom - top) < 0) {
+					bottom_count.store(bottom + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+
+				task_t* task = ring_buffer[bottom % capacity].load(std::memory_order_relaxed);
+				if (top == bottom) {
+					// the last element, may race with a concurrent steal()
+					if (!top_count.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+						task = nullptr; // lost the race
+					}
+
+					bottom_count.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				return task;
+			}
+
+			// steal a task from top (fifo), can be called from any thread.
+			task_t* steal() noexcept {
+				size_t top = top_count.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				size_t bottom = bottom_count.load(std::memory_order_acquire);
+
+				if (static_cast<ptrdiff_t>(bottom - top) <= 0) {
+					return nullptr;
+				}
+
+				task_t* task = ring_buffer[top % capacity].load(std::memory_order_relaxed);
+				if (!top_count.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					return nullptr; // lost the race, the caller may retry with another victim
+				}
+
+				return task;
+			}
+
+			bool empty() const noexcept {
+				return static_cast<ptrdiff_t>(bottom_count.load(std::memory_order_acquire) - top_count.load(std::memory_order_acquire)) <= 0;
+			}
+
+		protected:
+			std::atomic<size_t> top_count; // steal side
+			std::atomic<size_t> bottom_count; // owner side
+			std::atomic<task_t*> ring_buffer[capacity];
+		};
 	}
 
+	// cooperative cancellation token: cancel() is a one-way latch observed by
+	// dispatcher routines and awaitables that were tagged with the token, so
+	// already-queued work for abandoned requests is skipped instead of running
+	// to completion. routines can also poll is_cancelled() at safe points.
+	struct iris_cancellation_token_t {
+		iris_cancellation_token_t() noexcept {
+			cancelled.store(0, std::memory_order_relaxed);
+		}
+
+		iris_cancellation_token_t(const iris_cancellation_token_t&) = delete;
+		iris_cancellation_token_t& operator = (const iris_cancellation_token_t&) = delete;
+
+		void cancel() noexcept {
+			cancelled.store(1, std::memory_order_release);
+		}
+
+		bool is_cancelled() const noexcept {
+			return cancelled.load(std::memory_order_acquire) != 0;
+		}
+
+	protected:
+		std::atomic<size_t> cancelled;
+	};
+
 	// dispatch routines:
 	//     1. from warp to warp. (queue_routine/queue_routine_post).
 	//     2. from warp to external in parallel (queue_routine_parallel).
@@ -218,21 +348,61 @@ namespace iris {
 		};
 
 		struct grid_storage_t {
-			grid_storage_t() noexcept : current_version(0), next_version(0) {
+			static constexpr size_t cache_line_size = 64;
+
+			// per-thread slot aligned to whole cache lines: the queue and its
+			// version counter are touched by one thread each, adjacent slots
+			// used to share lines and ping-pong between cores. the slot array is
+			// allocated through iris_alloc_aligned rather than std::vector so
+			// the 64-byte alignment holds even before C++17's aligned new,
+			// IRIS_DEBUG_FALSE_SHARING audits the result at initialization.
+			struct alignas(cache_line_size) thread_slot_t {
+				thread_slot_t() noexcept(noexcept(queue_buffer_t())) : queue_version(0) {}
+
+				queue_buffer_t queue_buffer;
+				size_t queue_version;
+			};
+
+			static_assert(sizeof(thread_slot_t) % cache_line_size == 0, "thread_slot_t must cover whole cache lines!");
+
+			grid_storage_t() noexcept : slots(nullptr), slot_count(0), current_version(0), next_version(0) {
 				barrier_version.store(0, std::memory_order_relaxed);
 			}
 
 			grid_storage_t(grid_storage_t&& rhs) noexcept {
 				barrier_version.store(rhs.barrier_version.load(std::memory_order_acquire), std::memory_order_release);
-				queue_buffers = std::move(rhs.queue_buffers);
-				queue_versions = std::move(rhs.queue_versions);
+				slots = rhs.slots;
+				slot_count = rhs.slot_count;
 				current_version = rhs.current_version;
 				next_version = rhs.next_version;
+
+				rhs.slots = nullptr;
+				rhs.slot_count = 0;
+			}
+
+			~grid_storage_t() noexcept {
+				if (slots != nullptr) {
+					for (size_t i = 0; i < slot_count; i++) {
+						slots[i].~thread_slot_t();
+					}
+
+					iris_free_aligned(slots, slot_count * sizeof(thread_slot_t));
+				}
+			}
+
+			void initialize(size_t thread_count) {
+				IRIS_ASSERT(slots == nullptr);
+				slots = reinterpret_cast<thread_slot_t*>(iris_alloc_aligned(thread_count * sizeof(thread_slot_t), cache_line_size));
+				for (size_t i = 0; i < thread_count; i++) {
+					new (&slots[i]) thread_slot_t();
+				}
+
+				slot_count = thread_count;
 			}
 
 			bool empty() const noexcept {
-				for (size_t i = 0; i < queue_buffers.size(); i++) {
-					if (!queue_buffers[i].empty())
+				for (size_t i = 0; i < slot_count; i++) {
+					if (!slots[i].queue_buffer.empty())
 						return false;
 				}
 
@@ -240,8 +410,8 @@ namespace iris {
 			}
 
 			std::atomic<size_t> barrier_version;
-			std::vector<queue_buffer_t> queue_buffers;
-			std::vector<size_t> queue_versions;
+			thread_slot_t* slots;
+			size_t slot_count;
 			size_t current_version;
 			size_t next_version;
 		};
@@ -258,22 +428,38 @@ namespace iris {
 		typename std::enable_if<s>::type init_storage(size_t thread_count) noexcept {}
 
 		template <bool s>
-		typename std::enable_if<!s>::type init_storage(size_t thread_count) noexcept(noexcept(std::declval<iris_warp_t>().storage.queue_buffers.resize(thread_count))) {
-			storage.queue_buffers.resize(thread_count);
-			storage.queue_versions.resize(thread_count);
+		typename std::enable_if<!s>::type init_storage(size_t thread_count) {
+			storage.initialize(thread_count);
+
+#if IRIS_DEBUG_FALSE_SHARING
+			for (size_t i = 1; i < storage.slot_count; i++) {
+				// hot fields of neighbouring threads must live in different lines
+				IRIS_ASSERT(reinterpret_cast<size_t>(&storage.slots[i].queue_buffer) / grid_storage_t::cache_line_size != reinterpret_cast<size_t>(&storage.slots[i - 1].queue_version) / grid_storage_t::cache_line_size);
+			}
+#endif
 		}
 
 		// initialize with specified priority, all tasks that runs on this warp will be scheduled with this priority
-		explicit iris_warp_t(async_worker_t& worker, size_t prior = 0) : async_worker(worker), priority(prior), stack_next_warp(nullptr), parallel_task_resurrect_head(nullptr) {
+		explicit iris_warp_t(async_worker_t& worker, size_t prior = 0) : async_worker(worker), priority(prior), affinity(~size_t(0)), stack_next_warp(nullptr), parallel_task_resurrect_head(nullptr) {
 			init_storage<strand>(worker.get_thread_count());
 
 			thread_warp.store(nullptr, std::memory_order_relaxed);
 			parallel_task_head.store(nullptr, std::memory_order_relaxed);
 			suspend_count.store(0, std::memory_order_relaxed);
+			join_status.store(0, std::memory_order_relaxed);
+			boost_priority.store(~size_t(0), std::memory_order_relaxed);
+			reset_stats();
 			queueing.store(queue_state_t::idle, std::memory_order_release);
 		}
 
-		iris_warp_t(iris_warp_t&& rhs) noexcept : async_worker(rhs.async_worker), storage(std::move(rhs.storage)), priority(rhs.priority), stack_next_warp(rhs.stack_next_warp), parallel_task_resurrect_head(rhs.parallel_task_resurrect_head) {
+		iris_warp_t(iris_warp_t&& rhs) noexcept : async_worker(rhs.async_worker), storage(std::move(rhs.storage)), priority(rhs.priority), affinity(rhs.affinity), execute_quota(rhs.execute_quota), stack_next_warp(rhs.stack_next_warp), parallel_task_resurrect_head(rhs.parallel_task_resurrect_head) {
+			reset_stats();
+			join_status.store(rhs.join_status.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			boost_priority.store(rhs.boost_priority.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			pending_task_count.store(rhs.pending_task_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			escalation_threshold = rhs.escalation_threshold;
+			escalation_priority = rhs.escalation_priority;
+			escalated.store(rhs.escalated.load(std::memory_order_relaxed), std::memory_order_relaxed);
 			thread_warp.store(rhs.thread_warp.load(std::memory_order_relaxed), std::memory_order_relaxed);
 			parallel_task_head.store(rhs.parallel_task_head.load(std::memory_order_relaxed), std::memory_order_relaxed);
 			suspend_count.store(rhs.suspend_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
@@ -296,6 +482,73 @@ namespace iris {
 			IRIS_ASSERT(!has_parallel_task());
 		}
 
+#if IRIS_ENABLE_STATS
+		// per-warp scheduling counters, all updated with relaxed atomics
+		struct stats_t {
+			size_t executed_count; // total tasks executed
+			size_t max_batch_count; // longest run of one execute_internal pass
+			size_t suspend_count;
+			size_t resume_count;
+			size_t preempt_failed_count;
+			size_t flush_count; // execute requests committed to the worker
+		};
+
+		// take a consistent-enough snapshot of the counters
+		stats_t get_stats() const noexcept {
+			stats_t stats;
+			stats.executed_count = stat_executed_count.load(std::memory_order_relaxed);
+			stats.max_batch_count = stat_max_batch_count.load(std::memory_order_relaxed);
+			stats.suspend_count = stat_suspend_count.load(std::memory_order_relaxed);
+			stats.resume_count = stat_resume_count.load(std::memory_order_relaxed);
+			stats.preempt_failed_count = stat_preempt_failed_count.load(std::memory_order_relaxed);
+			stats.flush_count = stat_flush_count.load(std::memory_order_relaxed);
+			return stats;
+		}
+
+		void reset_stats() noexcept {
+			stat_executed_count.store(0, std::memory_order_relaxed);
+			stat_max_batch_count.store(0, std::memory_order_relaxed);
+			stat_suspend_count.store(0, std::memory_order_relaxed);
+			stat_resume_count.store(0, std::memory_order_relaxed);
+			stat_preempt_failed_count.store(0, std::memory_order_relaxed);
+			stat_flush_count.store(0, std::memory_order_relaxed);
+		}
+
+	protected:
+		void stat_record_batch(size_t count) noexcept {
+			if (count != 0) {
+				stat_executed_count.fetch_add(count, std::memory_order_relaxed);
+				size_t max_count = stat_max_batch_count.load(std::memory_order_relaxed);
+				while (count > max_count && !stat_max_batch_count.compare_exchange_weak(max_count, count, std::memory_order_relaxed)) {}
+			}
+		}
+
+		void stat_on_suspend() noexcept { stat_suspend_count.fetch_add(1, std::memory_order_relaxed); }
+		void stat_on_resume() noexcept { stat_resume_count.fetch_add(1, std::memory_order_relaxed); }
+		void stat_on_preempt_failed() noexcept { stat_preempt_failed_count.fetch_add(1, std::memory_order_relaxed); }
+		void stat_on_flush() noexcept { stat_flush_count.fetch_add(1, std::memory_order_relaxed); }
+
+		mutable std::atomic<size_t> stat_executed_count;
+		mutable std::atomic<size_t> stat_max_batch_count;
+		mutable std::atomic<size_t> stat_suspend_count;
+		mutable std::atomic<size_t> stat_resume_count;
+		mutable std::atomic<size_t> stat_preempt_failed_count;
+		mutable std::atomic<size_t> stat_flush_count;
+
+	public:
+#else
+		void reset_stats() noexcept {}
+
+	protected:
+		void stat_record_batch(size_t) noexcept {}
+		void stat_on_suspend() noexcept {}
+		void stat_on_resume() noexcept {}
+		void stat_on_preempt_failed() noexcept {}
+		void stat_on_flush() noexcept {}
+
+	public:
+#endif
+
 		// get stack warp pointer
 		iris_warp_t* get_stack_next() const noexcept {
 			return stack_next_warp;
@@ -328,6 +581,7 @@ namespace iris {
 
 				get_current_warp_internal() = stack_next_warp;
 				stack_next_warp = nullptr;
+				boost_priority.store(~size_t(0), std::memory_order_relaxed); // restore inherited priority
 				thread_warp.store(nullptr, std::memory_order_release);
 
 				if (queueing.exchange(queue_state_t::idle, std::memory_order_relaxed) == queue_state_t::pending) {
@@ -344,20 +598,28 @@ namespace iris {
 		// blocks all tasks preemptions, stacked with internally counting.
 		bool suspend() noexcept {
 			bool ret = suspend_count.fetch_add(1, std::memory_order_acquire) == 0;
+			stat_on_suspend();
 			invoke_suspend_warp<iris_warp_t>();
 			return ret;
 		}
 
 		// allows all tasks preemptions, stacked with internally counting.
 		// returns true on final resume.
+		// resume-triggered flushes coalesce: while an execute submission from a
+		// previous resume is still in flight, further resume() calls skip the
+		// redundant submission — interleaved suspend/resume storms collapse to
+		// one execute_t per actual batch of work.
 		bool resume() noexcept(noexcept(std::declval<iris_warp_t>().flush())) {
 			bool ret = suspend_count.fetch_sub(1, std::memory_order_release) == 1;
+			stat_on_resume();
 
 			if (ret) {
 				invoke_resume_warp<iris_warp_t>();
 				// all suspend requests removed, try to flush me
 				if (queueing.exchange(queue_state_t::idle, std::memory_order_relaxed) == queue_state_t::pending) {
-					flush();
+					if (resume_flush_in_flight.exchange(1, std::memory_order_acquire) == 0) {
+						flush();
+					}
 				}
 			}
 
@@ -365,23 +627,77 @@ namespace iris {
 		}
 
 		// send task to this warp. call it directly if we are on warp.
+		// inline execution is bounded per thread: beyond the configured nesting
+		// depth the routine falls back to posting, so the fast path is safe to
+		// use from arbitrarily nested call sites without blowing the stack.
 		template <typename callable_t>
 		void queue_routine(callable_t&& func) noexcept(noexcept(func()) &&
 			noexcept(std::declval<iris_warp_t>().template push<strand>(std::forward<callable_t>(func)))) {
 
 			// can be executed immediately?
 			// try to acquire execution, if it fails, just go posting
-			preempt_guard_t preempt_guard(*this, 0);
-			if (preempt_guard) {
-				func();
-			} else {
-				queue_routine_post<callable_t>(std::forward<callable_t>(func));
+			size_t& depth = get_inline_depth_internal();
+			if (depth < inline_depth_limit) {
+				preempt_guard_t preempt_guard(*this, 0);
+				if (preempt_guard) {
+					inline_depth_guard_t depth_guard(depth);
+					func();
+					return;
+				}
+			}
+
+			queue_routine_post<callable_t>(std::forward<callable_t>(func));
+		}
+
+		// nesting levels queue_routine may execute inline before falling back
+		// to posting, per calling thread
+		void set_inline_depth_limit(size_t depth) noexcept {
+			inline_depth_limit = depth;
+		}
+
+		// effective scheduling priority: the static priority, boosted while a
+		// higher-priority warp has posted work here (priority inheritance),
+		// restored at yield()
+		size_t get_effective_priority() const noexcept {
+			return std::min(priority, boost_priority.load(std::memory_order_relaxed));
+		}
+
+		// flush priority including depth-triggered escalation with hysteresis,
+		// see set_flush_escalation
+		size_t get_flush_priority() noexcept {
+			size_t effective = get_effective_priority();
+			if (escalation_threshold != 0) {
+				size_t depth = pending_task_count.load(std::memory_order_relaxed);
+				size_t state = escalated.load(std::memory_order_relaxed);
+				if (state == 0 && depth >= escalation_threshold) {
+					escalated.store(1, std::memory_order_relaxed);
+					state = 1;
+				} else if (state != 0 && depth < escalation_threshold / 2) {
+					escalated.store(0, std::memory_order_relaxed);
+					state = 0;
+				}
+
+				if (state != 0) {
+					effective = std::min(effective, escalation_priority);
+				}
 			}
+
+			return effective;
 		}
 
 		// send task to warp indicated by warp. always post it to queue.
 		template <typename callable_t>
 		void queue_routine_post(callable_t&& func) noexcept(noexcept(std::declval<iris_warp_t>().template push<strand>(std::forward<callable_t>(func)))) {
+			// priority inheritance: posting from a higher-priority warp boosts
+			// this warp's effective priority until it yields, avoiding inversion
+			// when our queued tasks stand between the poster and its deadline
+			iris_warp_t* current = get_current_warp_internal();
+			if (current != nullptr && current != this) {
+				size_t poster_priority = current->get_effective_priority();
+				size_t boosted = boost_priority.load(std::memory_order_relaxed);
+				while (poster_priority < boosted && !boost_priority.compare_exchange_weak(boosted, poster_priority, std::memory_order_relaxed)) {}
+			}
+
 			if (!strand && async_worker.get_current_thread_index() == ~size_t(0)) {
 				async_worker.queue(external_t<typename std::remove_reference<callable_t>::type>(*this, std::forward<callable_t>(func)), priority);
 			} else {
@@ -407,6 +723,31 @@ namespace iris {
 			queue_barrier_internal<strand>();
 		}
 
+		// set the time slice (microseconds) for cooperative long routines on
+		// this warp, 0 (the default) disables slice tracking. long routines
+		// poll yield_check() and hand their remaining work to requeue_routine
+		// when it reports expiry, giving bounded warp latency without
+		// hand-written state machines around every loop.
+		void set_time_slice(size_t microseconds) noexcept {
+			time_slice = microseconds;
+		}
+
+		// called from inside a running routine of this warp: true once the
+		// current execute pass has exceeded the configured time slice
+		bool yield_check() const noexcept {
+			IRIS_ASSERT(get_current_warp_internal() == this);
+			return time_slice != 0 && now_microseconds() - slice_timestamp >= time_slice;
+		}
+
+		// re-queue the remaining work of a time-sliced routine: a barrier keeps
+		// it ordered after everything queued up to this point, so observable
+		// ordering matches the non-sliced execution
+		template <typename callable_t>
+		void requeue_routine(callable_t&& func) {
+			queue_barrier();
+			queue_routine_post(std::forward<callable_t>(func));
+		}
+
 		// cleanup the dispatcher, pass true to 'execute_remaining' to make sure all tasks are executed finally.
 		template <bool execute_remaining = true, bool finalize = false, typename iterator_t = iris_warp_t*, typename waiter_t>
 		static bool join(iterator_t begin, iterator_t end, waiter_t&& waiter) {
@@ -470,6 +811,63 @@ namespace iris {
 			return join<execute_remaining, finalize>(this, this + 1, std::forward<waiter_t>(waiter));
 		}
 
+		// shared (reader) join over a warp set: marks every warp as being read so
+		// exclusive joins hold off, without suspending the warps — they keep
+		// executing their own tasks, which is safe for read-only phases.
+		// returns false without side effects when an exclusive join is active.
+		template <typename iterator_t = iris_warp_t*>
+		static bool join_shared(iterator_t begin, iterator_t end) noexcept {
+			for (iterator_t p = begin; p != end; ++p) {
+				size_t status = (*p).join_status.load(std::memory_order_acquire);
+				do {
+					if ((status & join_writer_mask) != 0) {
+						// exclusive join active, roll back what we acquired
+						for (iterator_t q = begin; q != p; ++q) {
+							(*q).join_status.fetch_sub(1, std::memory_order_release);
+						}
+
+						return false;
+					}
+				} while (!(*p).join_status.compare_exchange_weak(status, status + 1, std::memory_order_acquire, std::memory_order_acquire));
+			}
+
+			return true;
+		}
+
+		template <typename iterator_t = iris_warp_t*>
+		static void leave_shared(iterator_t begin, iterator_t end) noexcept {
+			for (iterator_t p = begin; p != end; ++p) {
+				IRIS_ASSERT(((*p).join_status.load(std::memory_order_acquire) & ~join_writer_mask) != 0);
+				(*p).join_status.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		// exclusive (writer) join: blocks out new readers, waits for active ones
+		// and then performs the usual suspending join. returns false when a
+		// reader or another writer holds the set, call again like join().
+		template <bool execute_remaining = true, bool finalize = false, typename iterator_t = iris_warp_t*, typename waiter_t>
+		static bool join_exclusive(iterator_t begin, iterator_t end, waiter_t&& waiter) {
+			// acquire the writer bit on every warp of the set
+			for (iterator_t p = begin; p != end; ++p) {
+				size_t expected = 0;
+				if (!(*p).join_status.compare_exchange_strong(expected, join_writer_mask, std::memory_order_acquire, std::memory_order_relaxed)) {
+					for (iterator_t q = begin; q != p; ++q) {
+						(*q).join_status.fetch_and(~join_writer_mask, std::memory_order_release);
+					}
+
+					return waiter();
+				}
+			}
+
+			while (!join<execute_remaining, finalize>(begin, end, waiter)) {}
+
+			for (iterator_t p = begin; p != end; ++p) {
+				(*p).join_status.fetch_and(~join_writer_mask, std::memory_order_release);
+			}
+
+			return true;
+		}
+
 		// get current thread's warp binding instance
 		static iris_warp_t* get_current_warp() noexcept {
 			return get_current_warp_internal();
@@ -483,6 +881,68 @@ namespace iris {
 			return async_worker;
 		}
 
+		// limit how many tasks one execute pass may drain before the warp
+		// yields and requeues itself at the back of the worker queue, so warps
+		// grouped on the same workers interleave fairly instead of one chatty
+		// warp monopolizing a thread. ~0 (the default) means unlimited.
+		// join() ignores the quota and always drains.
+		void set_execute_quota(size_t max_tasks_per_pass) noexcept {
+			execute_quota = max_tasks_per_pass;
+		}
+
+		size_t get_execute_quota() const noexcept {
+			return execute_quota;
+		}
+
+		// escalate flush priority when the warp backs up: once at least
+		// depth_threshold tasks are pending, flushes are queued at
+		// escalated_priority until the backlog drains below half the threshold
+		// (hysteresis), so a starving warp gets scheduled ahead without being
+		// permanently over-prioritized. threshold 0 disables escalation.
+		void set_flush_escalation(size_t depth_threshold, size_t escalated_priority) noexcept {
+			escalation_threshold = depth_threshold;
+			escalation_priority = escalated_priority;
+		}
+
+		// approximate count of tasks pending in this warp's queues
+		size_t get_pending_task_count() const noexcept {
+			return pending_task_count.load(std::memory_order_relaxed);
+		}
+
+		// bounded mode: cap the pending task depth honored by
+		// try_queue_routine_post, ~0 (the default) means unbounded
+		void set_pending_limit(size_t limit) noexcept {
+			pending_limit = limit;
+		}
+
+		size_t get_pending_limit() const noexcept {
+			return pending_limit;
+		}
+
+		// queue unless the warp is saturated; returns false for backpressure.
+		// producers in coroutines pair this with iris_backpressure_t to
+		// suspend until the warp drains.
+		template <typename callable_t>
+		bool try_queue_routine_post(callable_t&& func) {
+			if (pending_task_count.load(std::memory_order_relaxed) >= pending_limit) {
+				return false;
+			}
+
+			queue_routine_post(std::forward<callable_t>(func));
+			return true;
+		}
+
+		// hint that this warp's tasks prefer workers near the given thread index,
+		// e.g. the numa node where its storage was allocated. see queue_task for
+		// how the hint maps onto task_head duplicate slots.
+		void set_affinity(size_t thread_index) noexcept {
+			affinity = thread_index;
+		}
+
+		size_t get_affinity() const noexcept {
+			return affinity;
+		}
+
 	protected:
 		bool has_parallel_task() const noexcept {
 			return parallel_task_head.load(std::memory_order_acquire) != nullptr || parallel_task_resurrect_head != nullptr;
@@ -555,6 +1015,7 @@ namespace iris {
 				return true;
 			} else {
 				IRIS_ASSERT(get_current_warp_internal() != this);
+				stat_on_preempt_failed();
 				return false;
 			}
 		}
@@ -589,11 +1050,45 @@ namespace iris {
 			}
 		}
 
+		static size_t now_microseconds() noexcept {
+			return iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// start a fresh time slice for the beginning execute pass
+		void mark_slice() noexcept {
+			if (time_slice != 0) {
+				slice_timestamp = now_microseconds();
+			}
+		}
+
 		// get current warp index (saved in thread_local storage)
 		static iris_warp_t*& get_current_warp_internal() noexcept {
 			return iris_static_instance_t<iris_warp_t*>::get_thread_local();
 		}
 
+		struct inline_depth_t {
+			size_t value = 0;
+		};
+
+		// per-thread inline execution nesting level of queue_routine
+		static size_t& get_inline_depth_internal() noexcept {
+			return iris_static_instance_t<inline_depth_t>::get_thread_local().value;
+		}
+
+		// exception-safe depth accounting for inline execution
+		struct inline_depth_guard_t {
+			inline_depth_guard_t(size_t& d) noexcept : depth(d) {
+				depth++;
+			}
+
+			~inline_depth_guard_t() noexcept {
+				depth--;
+			}
+
+		private:
+			size_t& depth;
+		};
+
 		template <bool s>
 		typename std::enable_if<s>::type queue_barrier_internal() {}
 
@@ -614,7 +1109,9 @@ namespace iris {
 			queueing.store(queue_state_t::executing, std::memory_order_release);
 			iris_warp_t** warp_ptr = &get_current_warp_internal();
 			IRIS_ASSERT(*warp_ptr == this);
+			mark_slice();
 
+			size_t budget = force ? ~size_t(0) : execute_quota;
 			size_t execute_counter;
 			do {
 				execute_counter = 0;
@@ -638,14 +1135,25 @@ namespace iris {
 					p->next = nullptr;
 					async_worker.execute_task(p);
 					execute_counter++;
+					pending_task_count.fetch_sub(1, std::memory_order_relaxed);
 
 					if ((!force && is_suspended()) || *warp_ptr != this) {
 						return;
 					}
 
+					if (--budget == 0) {
+						// fairness quota exhausted, requeue the remainder so
+						// sibling warps get their turn (see set_execute_quota)
+						stat_record_batch(execute_counter);
+						queueing.store(queue_state_t::pending, std::memory_order_relaxed);
+						return;
+					}
+
 					// go over next task
 					p = storage.executing_head;
 				}
+
+				stat_record_batch(force ? 0 : execute_counter);
 			} while (execute_counter != 0);
 		}
 
@@ -657,20 +1165,22 @@ namespace iris {
 			queueing.store(queue_state_t::executing, std::memory_order_release);
 			iris_warp_t** warp_ptr = &get_current_warp_internal();
 			IRIS_ASSERT(*warp_ptr == this);
+			mark_slice();
 
 			// execute tasks in queue_buffer until suspended 
-			std::vector<queue_buffer_t>& queue_buffers = storage.queue_buffers;
-			std::vector<size_t>& queue_versions = storage.queue_versions;
+			typename grid_storage_t::thread_slot_t* slots = storage.slots;
+			size_t slot_count = storage.slot_count;
 			size_t& current_version = storage.current_version;
 			size_t& next_version = storage.next_version;
+			size_t budget = force ? ~size_t(0) : execute_quota;
 			size_t execute_counter;
 
 			do {
 				execute_counter = 0;
 				size_t step_version = current_version;
-				for (size_t i = 0; i < queue_buffers.size(); i++) {
-					queue_buffer_t& buffer = queue_buffers[i];
-					size_t& counter = queue_versions[i];
+				for (size_t i = 0; i < slot_count; i++) {
+					queue_buffer_t& buffer = slots[i].queue_buffer;
+					size_t& counter = slots[i].queue_version;
 
 					next_version = counter;
 					while (static_cast<ptrdiff_t>(current_version - counter) >= 0 && !buffer.empty()) {
@@ -680,9 +1190,18 @@ namespace iris {
 						func(); // may throws exceptions
 						execute_counter++;
 						counter = next_version;
+						pending_task_count.fetch_sub(1, std::memory_order_relaxed);
 
 						if ((!force && is_suspended()) || *warp_ptr != this)
 							return;
+
+						if (--budget == 0) {
+							// fairness quota exhausted, requeue the remainder so
+							// sibling warps get their turn (see set_execute_quota)
+							stat_record_batch(execute_counter);
+							queueing.store(queue_state_t::pending, std::memory_order_relaxed);
+							return;
+						}
 					}
 
 					if (current_version + 1 == counter) {
@@ -693,6 +1212,7 @@ namespace iris {
 				}
 
 				current_version = step_version;
+				stat_record_batch(force ? 0 : execute_counter);
 			} while (execute_counter != 0);
 		}
 
@@ -700,6 +1220,9 @@ namespace iris {
 		void execute() noexcept(noexcept(std::declval<iris_warp_t>().template execute_internal<s, force>())) {
 			IRIS_PROFILE_SCOPE(__FUNCTION__);
 
+			// the in-flight resume submission (if any) is being served now
+			resume_flush_in_flight.store(0, std::memory_order_release);
+
 			if (!is_suspended()) {
 				// try to acquire execution, if it fails, there must be another thread doing the same thing
 				// and it's ok to return immediately.
@@ -743,7 +1266,7 @@ namespace iris {
 					IRIS_ASSERT(is_suspended());
 					parallel_task_resurrect_head = p->next;
 					p->next = nullptr;
-					async_worker.queue_task(p, priority);
+					async_worker.queue_task(p, get_effective_priority(), affinity);
 
 					p = parallel_task_resurrect_head;
 				}
@@ -757,7 +1280,8 @@ namespace iris {
 			if (queueing.load(std::memory_order_acquire) != queue_state_t::pending) {
 				if (queueing.exchange(queue_state_t::pending, std::memory_order_acq_rel) == queue_state_t::idle) {
 					invoke_flush_warp<iris_warp_t>();
-					async_worker.queue(execute_t(*this), priority);
+					stat_on_flush();
+					async_worker.queue(execute_t(*this), get_flush_priority(), affinity);
 				}
 			}
 		}
@@ -765,6 +1289,7 @@ namespace iris {
 		// queue task from specified thread.
 		template <bool s, typename callable_t>
 		typename std::enable_if<s>::type push(callable_t&& func) {
+			pending_task_count.fetch_add(1, std::memory_order_relaxed);
 			task_t* task = async_worker.new_task(std::forward<callable_t>(func));
 
 			// avoid legacy compiler bugs
@@ -781,19 +1306,19 @@ namespace iris {
 		typename std::enable_if<!s>::type push(callable_t&& func) noexcept(
 			noexcept(std::declval<queue_buffer_t>().push(std::forward<callable_t>(func))) &&
 			noexcept(std::declval<iris_warp_t>().flush())) {
+			pending_task_count.fetch_add(1, std::memory_order_relaxed);
 			size_t thread_index = async_worker.get_current_thread_index();
 			if (thread_index != ~size_t(0)) {
-				std::vector<queue_buffer_t>& queue_buffers = storage.queue_buffers;
-				IRIS_ASSERT(thread_index < queue_buffers.size());
-				queue_buffer_t& buffer = queue_buffers[thread_index];
+				IRIS_ASSERT(thread_index < storage.slot_count);
+				queue_buffer_t& buffer = storage.slots[thread_index].queue_buffer;
 				buffer.push(std::forward<callable_t>(func));
 
 				// flush the task immediately
 				flush();
 			} else {
 				IRIS_ASSERT(async_worker.is_terminated());
-				IRIS_ASSERT(!storage.queue_buffers.empty());
-				storage.queue_buffers[0].push(std::forward<callable_t>(func));
+				IRIS_ASSERT(storage.slot_count != 0);
+				storage.slots[0].queue_buffer.push(std::forward<callable_t>(func));
 			}
 		}
 
@@ -806,84 +1331,734 @@ namespace iris {
 		task_t* parallel_task_resurrect_head;
 		typename std::conditional<strand, chain_storage_t, grid_storage_t>::type storage; // task storage
 		size_t priority;
+		size_t affinity; // preferred thread index for scheduling, ~0 for no preference
+		size_t execute_quota = ~size_t(0); // max tasks per execute pass, ~0 unlimited
+		size_t inline_depth_limit = 16; // max inline nesting of queue_routine per thread
+		size_t time_slice = 0; // microseconds per execute pass for yield_check, 0 disables
+		size_t slice_timestamp = 0; // start of the current execute pass
+		size_t escalation_threshold = 0; // pending depth triggering escalation, 0 disables
+		size_t escalation_priority = 0; // priority used while escalated
+		size_t pending_limit = ~size_t(0); // saturation bound for try_queue_routine_post
+		std::atomic<size_t> pending_task_count { 0 }; // approximate queued-but-unexecuted tasks
+		std::atomic<size_t> escalated { 0 }; // hysteresis state of flush escalation
+		std::atomic<size_t> resume_flush_in_flight { 0 }; // coalesces resume-triggered flushes
+		static constexpr size_t join_writer_mask = (size_t(1) << (sizeof(size_t) * 8 - 1));
+		std::atomic<size_t> join_status; // reader count, writer flag in the high bit
+		std::atomic<size_t> boost_priority; // inherited priority floor, ~0 when not boosted
 		iris_warp_t* stack_next_warp;
 	};
 
-	// dispatcher based-on directed-acyclic graph
-	template <typename base_warp_t>
-	struct iris_dispatcher_t {
-		using warp_t = base_warp_t;
-		// wraps task data
-		using function_t = typename warp_t::function_t;
-		struct routine_t {
-		protected:
-			template <typename func_t>
-			routine_t(warp_t* w, func_t&& func, size_t prior) noexcept : routine(std::forward<func_t>(func)), priority(prior), warp(w), next(nullptr) {
-				lock_count.store(1, std::memory_order_relaxed);
-				std::memset(next_tasks, 0, sizeof(next_tasks));
+	// statically-typed warp for fixed-function workloads: fixing func_t to one
+	// concrete callable type (instead of the type-erasing std::function
+	// default) makes the whole grid-mode queue→execute drain loop monomorphic —
+	// execute_internal invokes the routine body directly from the ring with no
+	// indirect call, so the compiler can inline it into the loop. only the
+	// once-per-batch flush submission still goes through the worker's erased
+	// task path.
+	template <typename async_worker_t, typename func_t>
+	using iris_static_warp_t = iris_warp_t<async_worker_t, false, void, func_t>;
+
+	// minimal cross-node federation for dispatcher graphs: a local routine can
+	// depend on a completion that happens on another host, and local
+	// completions can be exported to remote graphs. the descriptors crossing
+	// the wire are bare 64-bit edge ids (trivially serializable) handed to a
+	// pluggable transport hook; call deliver() from the receive path. the
+	// remote stand-ins ride directly on the defer/dispatch lock_count
+	// machinery, so ordering semantics match local edges.
+	template <typename dispatcher_t>
+	struct iris_dispatcher_federation_t {
+		using routine_t = typename dispatcher_t::routine_t;
+
+		iris_dispatcher_federation_t(dispatcher_t& disp) : dispatcher(disp) {}
+
+		// install the outgoing transport, invoked with the edge id to send
+		template <typename handler_t>
+		void set_transport(handler_t&& send) {
+			send_handler = std::forward<handler_t>(send);
+		}
+
+		// create the local stand-in for a remote completion: order() local
+		// routines after it and dispatch() it like any other root; it stays
+		// held until deliver(edge_id) arrives from the remote side.
+		routine_t* make_remote_dependency(uint64_t edge_id) {
+			routine_t* routine = dispatcher.allocate(nullptr);
+
+			std::lock_guard<std::mutex> guard(lock);
+			if (iris_binary_erase(delivered_early, edge_id)) {
+				// the notification raced ahead of the graph build, no hold needed
+				return routine;
 			}
 
-			friend struct iris_dispatcher_t<warp_t>;
-			function_t routine;
-			std::atomic<size_t> lock_count;
-			size_t priority;
-			warp_t* warp;
-			routine_t* next;
-			routine_t* next_tasks[4];
-		};
+			dispatcher.defer(routine);
+			iris_binary_insert(pending_remote, iris_make_key_value(edge_id, routine));
+			return routine;
+		}
 
-		// on execution of tasks
-		struct execute_t {
-			execute_t(iris_dispatcher_t& d, routine_t* r) noexcept : dispatcher(d), routine(r) {}
+		// when `routine` completes, notify the remote side owning edge_id
+		void export_completion(routine_t* routine, uint64_t edge_id) {
+			routine_t* notifier = dispatcher.allocate(nullptr, [this, edge_id]() {
+				if (send_handler) {
+					send_handler(edge_id);
+				}
+			});
 
-			void operator () () {
-				dispatcher.execute(routine);
-			}
+			dispatcher.order(routine, notifier);
+			dispatcher.dispatch(notifier);
+		}
 
-			iris_dispatcher_t& dispatcher;
-			routine_t* routine;
-		};
-		using async_worker_t = typename warp_t::async_worker_t;
-		using allocator_t = typename async_worker_t::template general_allocator_t<routine_t>;
+		// transport receive path: a remote edge completed. notifications that
+		// arrive before the local dependency exists are kept and consumed by
+		// the next make_remote_dependency with the same id.
+		void deliver(uint64_t edge_id) {
+			routine_t* routine = nullptr;
+			do {
+				std::lock_guard<std::mutex> guard(lock);
+				auto it = iris_binary_find(pending_remote.begin(), pending_remote.end(), edge_id);
+				if (it == pending_remote.end()) {
+					iris_binary_insert(delivered_early, edge_id);
+					return;
+				}
 
-		// all_complete will be called each time all tasks complete
-		template <typename func_t>
-		iris_dispatcher_t(async_worker_t& worker, func_t&& all_complete) noexcept
-			: async_worker(worker), completion(std::forward<func_t>(all_complete)) {
-			pending_count.store(0, std::memory_order_relaxed);
-			resurrect_routines.store(nullptr, std::memory_order_release);
+				routine = it->second;
+				pending_remote.erase(it);
+			} while (false);
+
+			dispatcher.dispatch(routine); // releases the defer hold
 		}
 
-		iris_dispatcher_t(async_worker_t& worker) noexcept : async_worker(worker) {
-			pending_count.store(0, std::memory_order_relaxed);
-			resurrect_routines.store(nullptr, std::memory_order_release);
+	protected:
+		dispatcher_t& dispatcher;
+		std::mutex lock;
+		std::function<void(uint64_t)> send_handler;
+		std::vector<iris_key_value_t<uint64_t, routine_t*>> pending_remote; // edge id -> held stand-in
+		std::vector<uint64_t> delivered_early; // notifications that beat the graph build
+	};
+
+	// task group: queueing through the group tags membership so speculative
+	// background work can be cancelled in bulk (bodies of not-yet-started
+	// members are skipped) and awaited at teardown, either by blocking join()
+	// or via notify_on_drain for coroutine/event composition.
+	template <typename async_worker_t>
+	struct iris_task_group_t {
+		iris_task_group_t() noexcept {
+			pending.store(0, std::memory_order_relaxed);
 		}
 
-		async_worker_t& get_async_worker() noexcept {
-			return async_worker;
+		~iris_task_group_t() noexcept {
+			IRIS_ASSERT(pending.load(std::memory_order_acquire) == 0); // join before destruction
 		}
 
-		// queue a routine, notice that priority takes effect if and only if warp == nullptr
-		template <typename func_t>
-		routine_t* allocate(warp_t* warp, func_t&& func, size_t priority = 0) {
-			routine_t* routine = routine_allocator.allocate(1);
-			new (routine) routine_t(warp, std::forward<func_t>(func), priority);
-			pending_count.fetch_add(1, std::memory_order_acquire);
-			return routine;
+		// queue a member task with given priority
+		template <typename callable_t>
+		void queue(async_worker_t& worker, callable_t&& callable, size_t priority = 0) {
+			pending.fetch_add(1, std::memory_order_acquire);
+			worker.queue(member_t<typename std::remove_reference<callable_t>::type>{ this, std::forward<callable_t>(callable) }, priority);
 		}
 
-		routine_t* allocate(warp_t* warp) {
-			return allocate(warp, function_t());
+		// drop every member that has not started yet; running members finish
+		void cancel() noexcept {
+			token.cancel();
 		}
 
-		// set routine dependency [from] -> [to]
-		void order(routine_t* from, routine_t* to) {
-			IRIS_ASSERT(from != nullptr);
-			IRIS_ASSERT(to != nullptr);
+		bool is_cancelled() const noexcept {
+			return token.is_cancelled();
+		}
 
-#if IRIS_DEBUG
-			validate(from, to);
-#endif
+		size_t get_pending_count() const noexcept {
+			return pending.load(std::memory_order_acquire);
+		}
+
+		// block the calling external thread until all members completed
+		void join() {
+			std::unique_lock<std::mutex> lock(drain_mutex);
+			drain_condition.wait(lock, [this]() { return pending.load(std::memory_order_acquire) == 0; });
+		}
+
+		// register a callback fired once the group drains; returns false and
+		// registers nothing when the group is already empty (call it yourself)
+		template <typename callback_t>
+		bool notify_on_drain(callback_t&& callback) {
+			std::lock_guard<std::mutex> guard(drain_mutex);
+			if (pending.load(std::memory_order_acquire) == 0) {
+				return false;
+			}
+
+			drain_callback = std::forward<callback_t>(callback);
+			return true;
+		}
+
+	protected:
+		template <typename callable_t>
+		struct member_t {
+			void operator () () {
+				if (!group->token.is_cancelled()) {
+					callable();
+				}
+
+				group->complete();
+			}
+
+			iris_task_group_t* group;
+			callable_t callable;
+		};
+
+		void complete() {
+			if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				std::function<void()> callback;
+				do {
+					std::lock_guard<std::mutex> guard(drain_mutex);
+					std::swap(callback, drain_callback);
+					drain_condition.notify_all();
+				} while (false);
+
+				if (callback) {
+					callback();
+				}
+			}
+		}
+
+	protected:
+		std::atomic<size_t> pending;
+		iris_cancellation_token_t token;
+		std::mutex drain_mutex;
+		std::condition_variable drain_condition;
+		std::function<void()> drain_callback;
+	};
+
+	// compiled frame graph: declare the (stable) topology once, compile() sorts
+	// the nodes into topological wavefronts, and every run() replays the waves
+	// as one bulk task submission per wave with a single countdown each,
+	// replacing the per-routine lock_count decrements and queue calls that a
+	// dynamic iris_dispatcher_t pays on every frame of an identical graph.
+	template <typename async_worker_t>
+	struct iris_wavefront_graph_t {
+		using callback_t = std::function<void()>;
+
+		// declare a node, returns its id
+		template <typename callback_data_t>
+		size_t add(callback_data_t&& func) {
+			nodes.emplace_back(std::forward<callback_data_t>(func));
+			return nodes.size() - 1;
+		}
+
+		// declare the edge from -> to
+		void order(size_t from, size_t to) {
+			IRIS_ASSERT(from < nodes.size() && to < nodes.size());
+			edges.emplace_back(iris_make_key_value(from, to));
+		}
+
+		// sort nodes into wavefronts, returns false when the graph has a cycle
+		bool compile() {
+			std::vector<size_t> levels(nodes.size(), 0);
+
+			// relax edges until levels settle, bounded by node count for cycles
+			bool changed = true;
+			size_t rounds = 0;
+			while (changed) {
+				if (rounds++ > nodes.size()) {
+					return false; // cycle
+				}
+
+				changed = false;
+				for (size_t i = 0; i < edges.size(); i++) {
+					size_t from = edges[i].first;
+					size_t to = edges[i].second;
+					if (levels[to] < levels[from] + 1) {
+						levels[to] = levels[from] + 1;
+						changed = true;
+					}
+				}
+			}
+
+			size_t max_level = 0;
+			for (size_t i = 0; i < levels.size(); i++) {
+				max_level = std::max(max_level, levels[i]);
+			}
+
+			waves.clear();
+			waves.resize(max_level + 1);
+			for (size_t i = 0; i < levels.size(); i++) {
+				waves[levels[i]].emplace_back(i);
+			}
+
+			return true;
+		}
+
+		size_t get_wave_count() const noexcept {
+			return waves.size();
+		}
+
+		// replay the compiled waves on the worker; completion runs after the
+		// last wave drains. compile() must have succeeded before.
+		template <typename completion_t>
+		void run(async_worker_t& worker, completion_t&& completion) {
+			IRIS_ASSERT(!waves.empty());
+			run_state_t* state = new run_state_t();
+			state->graph = this;
+			state->worker = &worker;
+			state->wave_index = 0;
+			state->completion = std::forward<completion_t>(completion);
+			submit_wave(state);
+		}
+
+	protected:
+		struct run_state_t {
+			iris_wavefront_graph_t* graph;
+			async_worker_t* worker;
+			size_t wave_index;
+			std::atomic<size_t> remaining;
+			callback_t completion;
+		};
+
+		// one bulk publish per wavefront, one atomic countdown per wave
+		static void submit_wave(run_state_t* state) {
+			std::vector<size_t>& wave = state->graph->waves[state->wave_index];
+			state->remaining.store(wave.size(), std::memory_order_release);
+
+			typename async_worker_t::task_base_t* head = nullptr;
+			typename async_worker_t::task_base_t* tail = nullptr;
+			for (size_t i = 0; i < wave.size(); i++) {
+				size_t node = wave[i];
+				auto* task = state->worker->new_task([state, node]() {
+					state->graph->nodes[node]();
+
+					if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+						// wave drained, fire the next one or finish
+						if (++state->wave_index < state->graph->waves.size()) {
+							submit_wave(state);
+						} else {
+							if (state->completion) {
+								state->completion();
+							}
+
+							delete state;
+						}
+					}
+				});
+
+				if (head == nullptr) {
+					head = tail = task;
+				} else {
+					tail->next = task;
+					tail = task;
+				}
+			}
+
+			state->worker->queue_task_batch(head, tail, 0);
+		}
+
+	protected:
+		std::vector<callback_t> nodes;
+		std::vector<iris_key_value_t<size_t, size_t>> edges;
+		std::vector<std::vector<size_t>> waves;
+	};
+
+	// adaptive warp: owns a strand-mode and a grid-mode warp over the same
+	// worker and forwards routines to the active one, so the queue mode can be
+	// migrated at runtime instead of being fixed by the template parameter.
+	// try_switch succeeds only at a quiescent point (retiring mode drained and
+	// idle, producers paused); with IRIS_ENABLE_STATS the per-mode counters
+	// (execute run lengths, preempt failures, flushes) guide the decision.
+	template <typename async_worker_t, typename func_t = std::function<void()>>
+	struct iris_adaptive_warp_t {
+		using strand_warp_t = iris_warp_t<async_worker_t, true, void, func_t>;
+		using grid_warp_t = iris_warp_t<async_worker_t, false, void, func_t>;
+
+		explicit iris_adaptive_warp_t(async_worker_t& worker, size_t priority = 0) : strand_warp(worker, priority), grid_warp(worker, priority) {
+			strand_active.store(1, std::memory_order_release);
+		}
+
+		bool is_strand() const noexcept {
+			return strand_active.load(std::memory_order_acquire) != 0;
+		}
+
+		template <typename callable_t>
+		void queue_routine(callable_t&& func) {
+			if (is_strand()) {
+				strand_warp.queue_routine(std::forward<callable_t>(func));
+			} else {
+				grid_warp.queue_routine(std::forward<callable_t>(func));
+			}
+		}
+
+		template <typename callable_t>
+		void queue_routine_post(callable_t&& func) {
+			if (is_strand()) {
+				strand_warp.queue_routine_post(std::forward<callable_t>(func));
+			} else {
+				grid_warp.queue_routine_post(std::forward<callable_t>(func));
+			}
+		}
+
+		void queue_barrier() {
+			if (is_strand()) {
+				strand_warp.queue_barrier();
+			} else {
+				grid_warp.queue_barrier();
+			}
+		}
+
+		// migrate to the requested mode. callers must have paused producers:
+		// the switch only happens when the retiring mode is fully drained and
+		// not executing, otherwise false is returned and nothing changes.
+		bool try_switch(bool to_strand) {
+			if (to_strand == is_strand()) {
+				return true;
+			}
+
+			if (to_strand) {
+				if (!grid_warp.empty() || grid_warp.running() || grid_warp.is_suspended()) {
+					return false;
+				}
+			} else {
+				if (!strand_warp.empty() || strand_warp.running() || strand_warp.is_suspended()) {
+					return false;
+				}
+			}
+
+			strand_active.store(to_strand ? 1 : 0, std::memory_order_release);
+			return true;
+		}
+
+		strand_warp_t& get_strand_warp() noexcept {
+			return strand_warp;
+		}
+
+		grid_warp_t& get_grid_warp() noexcept {
+			return grid_warp;
+		}
+
+		template <typename waiter_t>
+		bool join(waiter_t&& waiter) {
+			return strand_warp.join(waiter) && grid_warp.join(waiter);
+		}
+
+	protected:
+		strand_warp_t strand_warp;
+		grid_warp_t grid_warp;
+		std::atomic<size_t> strand_active;
+	};
+
+	// pipeline of warps with per-stage transforms: items pushed at the head are
+	// moved through the stages via queue_routine_post, each transform running
+	// on its stage's warp. every stage has a bounded in-flight count; push()
+	// reports backpressure at the head and inner stages hold items on their
+	// own warp until the next stage drains. item envelopes travel inside the
+	// worker's pooled task slots, no extra per-hop allocation.
+	template <typename element_t, typename warp_t>
+	struct iris_pipeline_t {
+		using transform_t = std::function<element_t(element_t&&)>;
+		using sink_t = std::function<void(element_t&&)>;
+
+		iris_pipeline_t() {}
+		iris_pipeline_t(const iris_pipeline_t&) = delete;
+		iris_pipeline_t& operator = (const iris_pipeline_t&) = delete;
+
+		~iris_pipeline_t() noexcept {
+			IRIS_ASSERT(get_in_flight() == 0); // drain before destruction
+			for (size_t i = 0; i < stages.size(); i++) {
+				delete stages[i];
+			}
+		}
+
+		// declare the next stage, must happen before the first push
+		template <typename transform_data_t>
+		void add_stage(warp_t* warp, transform_data_t&& transform, size_t capacity = ~size_t(0)) {
+			IRIS_ASSERT(warp != nullptr);
+			stage_t* stage = new stage_t();
+			stage->warp = warp;
+			stage->transform = std::forward<transform_data_t>(transform);
+			stage->capacity = capacity;
+			stage->in_flight.store(0, std::memory_order_relaxed);
+			stages.emplace_back(stage);
+		}
+
+		// consumer of fully transformed items, runs on the last stage's warp
+		template <typename sink_data_t>
+		void set_sink(sink_data_t&& s) {
+			sink = std::forward<sink_data_t>(s);
+		}
+
+		// push an item into the first stage, returns false when it is saturated
+		bool push(element_t item) {
+			IRIS_ASSERT(!stages.empty());
+			if (stages[0]->in_flight.load(std::memory_order_acquire) >= stages[0]->capacity) {
+				return false; // backpressure to the producer
+			}
+
+			advance(0, std::move(item));
+			return true;
+		}
+
+		// total items currently travelling through the pipeline
+		size_t get_in_flight() const noexcept {
+			size_t count = 0;
+			for (size_t i = 0; i < stages.size(); i++) {
+				count += stages[i]->in_flight.load(std::memory_order_acquire);
+			}
+
+			return count;
+		}
+
+	protected:
+		struct stage_t {
+			warp_t* warp;
+			transform_t transform;
+			size_t capacity;
+			std::atomic<size_t> in_flight;
+		};
+
+		void advance(size_t index, element_t&& item) {
+			stage_t& stage = *stages[index];
+			stage.in_flight.fetch_add(1, std::memory_order_acquire);
+			stage.warp->queue_routine_post(stage_routine_t{ this, index, std::move(item) });
+		}
+
+		// runs a stage transform and forwards the item
+		struct stage_routine_t {
+			void operator () () {
+				stage_t& stage = *pipeline->stages[index];
+				element_t out = stage.transform(std::move(item));
+				stage.in_flight.fetch_sub(1, std::memory_order_release);
+				pipeline->forward(index, std::move(out));
+			}
+
+			iris_pipeline_t* pipeline;
+			size_t index;
+			element_t item;
+		};
+
+		// holds an item on the previous stage's warp until the target drains
+		struct hold_routine_t {
+			void operator () () {
+				pipeline->forward(from_index, std::move(item));
+			}
+
+			iris_pipeline_t* pipeline;
+			size_t from_index;
+			element_t item;
+		};
+
+		void forward(size_t from_index, element_t&& item) {
+			size_t next = from_index + 1;
+			if (next < stages.size()) {
+				stage_t& target = *stages[next];
+				if (target.in_flight.load(std::memory_order_acquire) < target.capacity) {
+					advance(next, std::move(item));
+				} else {
+					// next stage saturated, spin the item on this stage's warp
+					stages[from_index]->warp->queue_routine_post(hold_routine_t{ this, from_index, std::move(item) });
+				}
+			} else if (sink) {
+				sink(std::move(item));
+			}
+		}
+
+	protected:
+		std::vector<stage_t*> stages;
+		sink_t sink;
+	};
+
+	// per-warp heap partition: same-warp allocate/deallocate touch only a
+	// private free list with no atomics at all, relying on the warp already
+	// serializing its own execution. frees arriving from other warps are pushed
+	// onto a lock-free remote inbox and drained into the private list the next
+	// time the owning warp allocates, so message-heavy warps lose the shared
+	// allocator synchronization entirely.
+	template <typename element_t, typename warp_t, size_t page_size = default_page_size>
+	struct iris_warp_allocator_t {
+		static_assert(sizeof(element_t) >= sizeof(void*), "element_t is too small for free list links!");
+
+		explicit iris_warp_allocator_t(warp_t& w) noexcept : warp(w), free_head(nullptr), bump_offset(0) {
+			remote_head.store(nullptr, std::memory_order_relaxed);
+		}
+
+		iris_warp_allocator_t(const iris_warp_allocator_t&) = delete;
+		iris_warp_allocator_t& operator = (const iris_warp_allocator_t&) = delete;
+
+		~iris_warp_allocator_t() noexcept {
+			for (size_t i = 0; i < pages.size(); i++) {
+				iris_free_aligned(pages[i], page_size);
+			}
+		}
+
+		// allocate one element slot, owner warp only
+		element_t* allocate(size_t n = 1) {
+			IRIS_ASSERT(n == 1);
+			IRIS_ASSERT(warp_t::get_current_warp() == &warp);
+
+			if (free_head == nullptr) {
+				// pick up frees from other warps before growing
+				drain_remote();
+			}
+
+			if (free_head != nullptr) {
+				slot_t* slot = free_head;
+				free_head = slot->next;
+				return reinterpret_cast<element_t*>(slot);
+			}
+
+			if (pages.empty() || bump_offset + slot_size > page_size) {
+				pages.emplace_back(reinterpret_cast<uint8_t*>(iris_alloc_aligned(page_size, alignof(element_t))));
+				bump_offset = 0;
+			}
+
+			element_t* p = reinterpret_cast<element_t*>(pages.back() + bump_offset);
+			bump_offset += slot_size;
+			return p;
+		}
+
+		// free a slot from any warp: same-warp frees stay on the private list,
+		// remote frees go through the lock-free inbox
+		void deallocate(element_t* p, size_t n = 1) noexcept {
+			IRIS_ASSERT(n == 1);
+			slot_t* slot = reinterpret_cast<slot_t*>(p);
+
+			if (warp_t::get_current_warp() == &warp) {
+				slot->next = free_head;
+				free_head = slot;
+			} else {
+				// avoid legacy compiler bugs
+				// see https://en.cppreference.com/w/cpp/atomic/atomic/compare_exchange
+				slot_t* node = remote_head.load(std::memory_order_relaxed);
+				do {
+					slot->next = node;
+				} while (!remote_head.compare_exchange_weak(node, slot, std::memory_order_acq_rel, std::memory_order_relaxed));
+			}
+		}
+
+		template <typename... args_t>
+		void construct(element_t* p, args_t&&... args) {
+			new (p) element_t(std::forward<args_t>(args)...);
+		}
+
+		void destroy(element_t* p) {
+			p->~element_t();
+		}
+
+		warp_t& get_warp() noexcept {
+			return warp;
+		}
+
+	protected:
+		struct slot_t {
+			slot_t* next;
+		};
+
+		static constexpr size_t slot_size = iris_to_alignment(sizeof(element_t), alignof(element_t) > sizeof(void*) ? alignof(element_t) : sizeof(void*));
+
+		void drain_remote() noexcept {
+			slot_t* p = remote_head.exchange(nullptr, std::memory_order_acquire);
+			while (p != nullptr) {
+				slot_t* q = p->next;
+				p->next = free_head;
+				free_head = p;
+				p = q;
+			}
+		}
+
+	protected:
+		warp_t& warp;
+		slot_t* free_head; // private free list, owner warp only
+		std::atomic<slot_t*> remote_head; // cross-warp free inbox
+		std::vector<uint8_t*> pages;
+		size_t bump_offset;
+	};
+
+	// dispatcher based-on directed-acyclic graph
+	// set use_arena to allocate all routines from a resettable arena: nodes are
+	// bump-allocated, recycled all at once by reset() in O(1), which suits graphs
+	// that are rebuilt with a similar shape every frame.
+	template <typename base_warp_t, bool use_arena = false>
+	struct iris_dispatcher_t {
+		using warp_t = base_warp_t;
+		// wraps task data
+		using function_t = typename warp_t::function_t;
+		struct routine_t {
+		protected:
+			template <typename func_t>
+			routine_t(warp_t* w, func_t&& func, size_t prior) noexcept : routine(std::forward<func_t>(func)), priority(prior), warp(w), token(nullptr), next(nullptr) {
+				lock_count.store(1, std::memory_order_relaxed);
+				std::memset(next_tasks, 0, sizeof(next_tasks));
+			}
+
+			friend struct iris_dispatcher_t<warp_t, use_arena>;
+			function_t routine;
+			std::atomic<size_t> lock_count;
+			size_t priority;
+			warp_t* warp;
+			const iris_cancellation_token_t* token;
+			routine_t* next;
+			routine_t* next_tasks[4];
+		};
+
+		// on execution of tasks
+		struct execute_t {
+			execute_t(iris_dispatcher_t& d, routine_t* r) noexcept : dispatcher(d), routine(r) {}
+
+			void operator () () {
+				dispatcher.execute(routine);
+			}
+
+			iris_dispatcher_t& dispatcher;
+			routine_t* routine;
+		};
+		using async_worker_t = typename warp_t::async_worker_t;
+		using allocator_t = typename async_worker_t::template general_allocator_t<routine_t>;
+
+		// all_complete will be called each time all tasks complete
+		template <typename func_t>
+		iris_dispatcher_t(async_worker_t& worker, func_t&& all_complete) noexcept
+			: async_worker(worker), completion(std::forward<func_t>(all_complete)) {
+			pending_count.store(0, std::memory_order_relaxed);
+			resurrect_routines.store(nullptr, std::memory_order_release);
+		}
+
+		iris_dispatcher_t(async_worker_t& worker) noexcept : async_worker(worker) {
+			pending_count.store(0, std::memory_order_relaxed);
+			resurrect_routines.store(nullptr, std::memory_order_release);
+		}
+
+		~iris_dispatcher_t() noexcept {
+			clear_arena<use_arena>();
+		}
+
+		async_worker_t& get_async_worker() noexcept {
+			return async_worker;
+		}
+
+		// queue a routine, notice that priority takes effect if and only if warp == nullptr
+		template <typename func_t>
+		routine_t* allocate(warp_t* warp, func_t&& func, size_t priority = 0) {
+			routine_t* routine = allocate_routine<use_arena>();
+			new (routine) routine_t(warp, std::forward<func_t>(func), priority);
+			pending_count.fetch_add(1, std::memory_order_acquire);
+			return routine;
+		}
+
+		routine_t* allocate(warp_t* warp) {
+			return allocate(warp, function_t());
+		}
+
+		// recycle the whole arena in O(1), only in arena mode.
+		// must not be called while routines are still pending.
+		template <bool enabled = use_arena>
+		typename std::enable_if<enabled>::type reset() noexcept {
+			IRIS_ASSERT(pending_count.load(std::memory_order_acquire) == 0);
+			IRIS_ASSERT(!has_exception());
+
+			arena.block_index = 0;
+			arena.slot_index = 0;
+		}
+
+		// set routine dependency [from] -> [to]
+		void order(routine_t* from, routine_t* to) {
+			IRIS_ASSERT(from != nullptr);
+			IRIS_ASSERT(to != nullptr);
+
+#if IRIS_DEBUG
+			validate(from, to);
+#endif
 
 			for (size_t i = 0; i < sizeof(from->next_tasks) / sizeof(from->next_tasks[0]); i++) {
 				routine_t*& p = from->next_tasks[i];
@@ -905,6 +2080,31 @@ namespace iris {
 			}
 		}
 
+		// declare a batch of dependencies at once, each element of [begin, end)
+		// dereferences to a pair {from, to}
+		template <typename iterator_t>
+		void order_batch(iterator_t begin, iterator_t end) {
+			for (iterator_t p = begin; p != end; ++p) {
+				order(p->first, p->second);
+			}
+		}
+
+		// toggle execution-locality hints: when enabled (the default), routines
+		// whose last dependency completed on a pool thread are published to
+		// that thread's preferred task slot, keeping linear chains
+		// thread-sticky instead of migrating their working set every hop
+		void set_locality_hints(bool enabled) noexcept {
+			locality_hints = enabled;
+		}
+
+		// tag a routine with a cancellation token: once the token fires, the
+		// routine body is skipped when its turn comes while the dependency
+		// chain still unlocks and completes, so cancelled graphs drain fast.
+		void set_cancellation(routine_t* routine, const iris_cancellation_token_t* token) noexcept {
+			IRIS_ASSERT(routine != nullptr);
+			routine->token = token;
+		}
+
 		// delay a task temporarily, must called before it actually runs
 		routine_t* defer(routine_t* routine) noexcept {
 			IRIS_ASSERT(pending_count.load(std::memory_order_acquire) != 0);
@@ -917,14 +2117,19 @@ namespace iris {
 		void dispatch(routine_t* routine) {
 			impl::atomic_guard_t<impl::guard_operation_t::add> guard(routine->lock_count);
 			if (routine->lock_count.fetch_sub(1, std::memory_order_relaxed) == 1) {
-				if (routine->routine) {
+				if (routine->routine && (routine->token == nullptr || !routine->token->is_cancelled())) {
 					// if not a warped routine, queue it to worker directly.
 					if (routine->warp == nullptr) {
-						async_worker.queue(execute_t(*this, routine), routine->priority);
+						// locality hint: successors are dispatched from the thread
+						// that just finished their predecessor, so preferring it
+						// keeps a chain's working set on the same core
+						async_worker.queue(execute_t(*this, routine), routine->priority, locality_hints ? async_worker_t::get_current_thread_index() : ~size_t(0));
 					} else {
 						routine->warp->queue_routine(execute_t(*this, routine));
 					}
 				} else {
+					// junction node or cancelled body, short-circuit the chain
+					// without a scheduling round trip
 					execute(routine);
 				}
 			}
@@ -943,8 +2148,7 @@ namespace iris {
 			if (p != nullptr) {
 				while (p != nullptr) {
 					routine_t* q = p->next;
-					p->~routine_t();
-					routine_allocator.deallocate(p, 1);
+					destroy_routine<use_arena>(p);
 					complete(false);
 					p = q;
 				}
@@ -976,6 +2180,22 @@ namespace iris {
 			return pending_count.load(std::memory_order_acquire);
 		}
 
+		// block the calling external thread until all pending routines complete,
+		// condition-variable backed so render/main threads stop busy-waiting on
+		// pending_count. coroutines should await a root via iris_listen_dispatch_t
+		// instead of blocking a worker thread here.
+		void wait_for_completion() {
+			std::unique_lock<std::mutex> lock(completion_mutex);
+			completion_condition.wait(lock, [this]() { return pending_count.load(std::memory_order_acquire) == 0; });
+		}
+
+		// timed variant, returns false on timeout
+		template <typename duration_t>
+		bool wait_for_completion(duration_t&& timeout) {
+			std::unique_lock<std::mutex> lock(completion_mutex);
+			return completion_condition.wait_for(lock, std::forward<duration_t>(timeout), [this]() { return pending_count.load(std::memory_order_acquire) == 0; });
+		}
+
 	protected:
 		// after finshing a routine, unlock the next_routines
 		struct routine_guard_t {
@@ -991,8 +2211,7 @@ namespace iris {
 						routine->next = node;
 					} while (!resurrect_routines->compare_exchange_weak(node, routine, std::memory_order_release, std::memory_order_relaxed));
 				} else {
-					routine->~routine_t();
-					dispatcher.routine_allocator.deallocate(routine, 1);
+					dispatcher.template destroy_routine<use_arena>(routine);
 				}
 			}
 
@@ -1014,35 +2233,129 @@ namespace iris {
 				if (completion) {
 					completion(*this, success);
 				}
+
+				// wake external waiters, see wait_for_completion
+				std::lock_guard<std::mutex> guard(completion_mutex);
+				completion_condition.notify_all();
 			}
 		}
 
 		void execute(routine_t* routine) {
 			IRIS_PROFILE_SCOPE(__FUNCTION__);
 
-			IRIS_ASSERT(routine->lock_count.load(std::memory_order_relaxed) == 0);
-			do {
-				routine_guard_t guard(*this, routine, &resurrect_routines);
-				if (routine->routine) {
-					routine->routine();
-					routine->routine = {};
-				}
-
-				for (size_t i = 0; i < sizeof(routine->next_tasks) / sizeof(routine->next_tasks[0]); i++) {
-					routine_t*& next = routine->next_tasks[i];
-					if (next != nullptr) {
-						IRIS_ASSERT(next != routine);
-						dispatch(next);
-						next = nullptr;
+			while (routine != nullptr) {
+				IRIS_ASSERT(routine->lock_count.load(std::memory_order_relaxed) == 0);
+				routine_t* fused = nullptr;
+
+				do {
+					routine_guard_t guard(*this, routine, &resurrect_routines);
+					if (routine->routine) {
+						// skip cancelled bodies, the chain below still unlocks
+						if (routine->token == nullptr || !routine->token->is_cancelled()) {
+							routine->routine();
+						}
+
+						routine->routine = {};
 					}
-				}
 
-				guard.cleanup();
-			} while (false);
+					size_t successor_count = 0;
+					for (size_t i = 0; i < sizeof(routine->next_tasks) / sizeof(routine->next_tasks[0]); i++) {
+						successor_count += routine->next_tasks[i] != nullptr ? 1u : 0u;
+					}
 
-			complete(true);
+					for (size_t i = 0; i < sizeof(routine->next_tasks) / sizeof(routine->next_tasks[0]); i++) {
+						routine_t*& next = routine->next_tasks[i];
+						if (next != nullptr) {
+							IRIS_ASSERT(next != routine);
+							routine_t* p = next;
+							next = nullptr;
+
+							// linear-chain fusion: a sole successor on the same warp
+							// whose last dependency we just released runs inline,
+							// skipping one queue/execute round trip per hop.
+							// a suspended warp must not fuse: the routine may have
+							// suspended itself to gate successors until an async
+							// resume, and the baseline dispatch path honors that
+							// through preempt_guard_t
+							if (successor_count == 1 && p->warp == routine->warp && p->routine && (p->warp != nullptr || p->priority == routine->priority) && (p->warp == nullptr || !p->warp->is_suspended())) {
+								impl::atomic_guard_t<impl::guard_operation_t::add> lock_guard(p->lock_count);
+								if (p->lock_count.fetch_sub(1, std::memory_order_relaxed) == 1) {
+									fused = p;
+								}
+
+								lock_guard.cleanup();
+							} else {
+								dispatch(p);
+							}
+						}
+					}
+
+					guard.cleanup();
+				} while (false);
+
+				complete(true);
+				routine = fused;
+			}
+		}
+
+		struct arena_storage_t {
+			arena_storage_t() noexcept : block_index(0), slot_index(0) {}
+
+			std::vector<routine_t*> blocks;
+			size_t block_index;
+			size_t slot_index;
+		};
+
+		struct arena_disabled_t {};
+		static constexpr size_t arena_block_capacity = default_block_size / sizeof(routine_t);
+
+		// bump-allocate a routine from the arena. graph building in arena mode is
+		// expected to happen from one thread at a time, as with typical per-frame builders.
+		template <bool enabled>
+		typename std::enable_if<enabled, routine_t*>::type allocate_routine() {
+			if (arena.block_index == arena.blocks.size()) {
+				arena.blocks.emplace_back(reinterpret_cast<routine_t*>(iris_alloc_aligned(sizeof(routine_t) * arena_block_capacity, alignof(routine_t))));
+			}
+
+			routine_t* routine = arena.blocks[arena.block_index] + arena.slot_index;
+			if (++arena.slot_index == arena_block_capacity) {
+				arena.slot_index = 0;
+				arena.block_index++;
+			}
+
+			return routine;
 		}
 
+		template <bool enabled>
+		typename std::enable_if<!enabled, routine_t*>::type allocate_routine() {
+			return routine_allocator.allocate(1);
+		}
+
+		template <bool enabled>
+		typename std::enable_if<enabled>::type destroy_routine(routine_t* routine) noexcept {
+			routine->~routine_t(); // storage is reclaimed by reset()
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled>::type destroy_routine(routine_t* routine) noexcept {
+			routine->~routine_t();
+			routine_allocator.deallocate(routine, 1);
+		}
+
+		template <bool enabled>
+		typename std::enable_if<enabled>::type clear_arena() noexcept {
+			IRIS_ASSERT(pending_count.load(std::memory_order_acquire) == 0);
+
+			for (size_t i = 0; i < arena.blocks.size(); i++) {
+				iris_free_aligned(arena.blocks[i], sizeof(routine_t) * arena_block_capacity);
+			}
+
+			arena.blocks.clear();
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled>::type clear_arena() noexcept {}
+
 		static void validate(routine_t* from, routine_t* to) noexcept {
 			IRIS_ASSERT(from != to);
 
@@ -1057,14 +2370,21 @@ namespace iris {
 	protected:
 		async_worker_t& async_worker;
 		allocator_t routine_allocator;
+		typename std::conditional<use_arena, arena_storage_t, arena_disabled_t>::type arena; // arena storage, empty unless use_arena
 		std::atomic<size_t> pending_count;
 		std::atomic<routine_t*> resurrect_routines;
 		std::function<void(iris_dispatcher_t&, bool)> completion;
+		std::mutex completion_mutex; // protects completion_condition for external waiters
+		std::condition_variable completion_condition;
+		bool locality_hints = true; // prefer the predecessor's thread for successors
 	};
 
 	// here we code a trivial worker demo
 	// could be replaced by your implementation
-	template <typename thread_t = std::thread, typename large_callable_t = std::function<void()>, template <typename...> class allocator_t = iris_default_object_allocator_t, size_t default_task_duplicate_count = 4, size_t default_sub_allocator_count = 4>
+	// set enable_work_stealing to make each thread prefer a private bounded deque (lifo for the owner,
+	// fifo for thieves), falling back to the shared per-priority lists on overflow or external threads.
+	// notice that tasks fetched from private deques ignore priorities.
+	template <typename thread_t = std::thread, typename large_callable_t = std::function<void()>, template <typename...> class allocator_t = iris_default_object_allocator_t, size_t default_task_duplicate_count = 4, size_t default_sub_allocator_count = 4, bool enable_work_stealing = false>
 	struct iris_async_worker_t {
 		// task wrapper
 		struct task_base_t {
@@ -1073,6 +2393,13 @@ namespace iris {
 			task_base_t* next;
 			void (*executor)(task_base_t* instance);
 			size_t alloc_index;
+#if IRIS_ENABLE_STATS
+			size_t stat_timestamp = 0; // microseconds at queue time
+			size_t stat_priority = 0;
+#endif
+#if IRIS_ENABLE_REPLAY
+			size_t replay_sequence = 0; // submission order id, see record()/replay()
+#endif
 
 			task_base_t(task_base_t&& rhs) noexcept = delete;
 			task_base_t& operator = (task_base_t&& rhs) noexcept = delete;
@@ -1110,7 +2437,13 @@ namespace iris {
 		using task_allocator_t = allocator_t<task_t<void (*)()>>;
 		using large_task_allocator_t = allocator_t<task_t<large_callable_t>>;
 
-		iris_async_worker_t() : waiting_thread_count(0), limit_count(0), internal_thread_count(0) {
+		static constexpr size_t default_spin_budget = 1024;
+
+		iris_async_worker_t() : waiting_thread_count(0), limit_count(0), internal_thread_count(0), spin_budget_limit(default_spin_budget), aging_interval(0), deadline_margin(2) {
+			nearest_deadline.store(~size_t(0), std::memory_order_relaxed);
+			blocking_count.store(0, std::memory_order_relaxed);
+			aging_timestamp.store(0, std::memory_order_relaxed);
+			spin_budget.store(64, std::memory_order_relaxed);
 			task_allocator_index.store(0, std::memory_order_relaxed);
 			running_count.store(0, std::memory_order_relaxed);
 			task_count.store(0, std::memory_order_relaxed);
@@ -1138,16 +2471,33 @@ namespace iris {
 			}
 
 			task_heads = std::move(heads);
+			init_task_deques<enable_work_stealing>();
+			init_latency_buckets();
 			terminated.store(0, std::memory_order_release);
 
 			for (size_t i = 0; i < internal_thread_count; i++) {
 				threads[i] = thread_t([this, i]() {
 					IRIS_PROFILE_THREAD("iris_async_worker", i);
+					if (thread_affinity_handler) {
+						thread_affinity_handler(i);
+					}
+
 					thread_loop(i);
 				});
 			}
 		}
 
+		// set a handler invoked from inside each internal worker thread right after
+		// it starts and before any task runs, receiving the thread index. intended
+		// for numa or cpu pinning (e.g. sched_setaffinity / numa_run_on_node /
+		// SetThreadGroupAffinity), which is left to the caller so this header stays
+		// portable. must be called before start().
+		template <typename handler_t>
+		void set_thread_affinity_handler(handler_t&& handler) {
+			IRIS_ASSERT(is_terminated());
+			thread_affinity_handler = std::forward<handler_t>(handler);
+		}
+
 		void make_current(size_t i) noexcept {
 			get_current_thread_index_internal() = i;
 		}
@@ -1212,9 +2562,37 @@ namespace iris {
 
 		// poll any task from thread poll manually with given priority in specified duration
 		// usually used in your customized thread procedures
+		// before parking on the condition variable, an adaptive backoff is performed:
+		// bounded exponential spin with pause instructions, escalating to yield.
+		// the spin budget grows while tasks keep arriving within the spin window and
+		// shrinks when parking was needed, tracking recent task inter-arrival times.
 		template <typename duration_t>
 		bool poll_delay(size_t priority, duration_t&& delay) {
 			if (poll(priority)) {
+				size_t budget = spin_budget.load(std::memory_order_relaxed);
+				for (size_t spin = 1; spin <= budget; spin <<= 1) {
+					for (size_t i = 0; i < spin; i++) {
+						iris_thread_pause();
+					}
+
+					if (!poll(priority)) {
+						// a task arrived within the spin window, pool is warm, extend the budget
+						spin_budget.store(std::min(budget * 2 + 1, spin_budget_limit), std::memory_order_relaxed);
+						return false;
+					}
+				}
+
+				// escalate to a scheduler yield once before parking
+				if (budget != 0) {
+					std::this_thread::yield();
+					if (!poll(priority)) {
+						return false;
+					}
+
+					// pool went cold, halve the budget so idle threads stop burning cycles
+					spin_budget.store(std::max(budget / 2, size_t(1)), std::memory_order_relaxed);
+				}
+
 				std::unique_lock<std::mutex> lock(mutex);
 				condition.wait_for(lock, std::forward<duration_t>(delay));
 				lock.unlock();
@@ -1230,6 +2608,33 @@ namespace iris {
 			return false;
 		}
 
+		// limit the spin rounds performed by poll_delay before parking, 0 disables spinning
+		void set_spin_budget(size_t count) noexcept {
+			spin_budget_limit = count;
+			spin_budget.store(std::min(spin_budget.load(std::memory_order_relaxed), count), std::memory_order_relaxed);
+		}
+
+		// marks the enclosing scope as a blocking external call: the worker
+		// temporarily lifts its running-thread limit by one and wakes a parked
+		// thread to cover the stalled one, restoring the limit on scope exit.
+		// pair with iris_blocking_t to shunt known-blocking funcs to a dedicated
+		// sub-pool instead.
+		struct blocking_guard_t {
+			blocking_guard_t(iris_async_worker_t& w) noexcept : worker(w) {
+				worker.blocking_count.fetch_add(1, std::memory_order_relaxed);
+				worker.wakeup_one();
+			}
+
+			~blocking_guard_t() noexcept {
+				worker.blocking_count.fetch_sub(1, std::memory_order_release);
+			}
+
+		private:
+			iris_async_worker_t& worker;
+		};
+
+		friend struct blocking_guard_t;
+
 		// guard for exception on running
 		struct running_guard_t {
 			std::atomic<size_t>& count;
@@ -1244,87 +2649,355 @@ namespace iris {
 			IRIS_ASSERT(task_count.load(std::memory_order_acquire) == 0);
 		}
 
-		// get current thread index
-		static size_t get_current_thread_index() noexcept { return get_current_thread_index_internal(); }
+		// get current thread index
+		static size_t get_current_thread_index() noexcept { return get_current_thread_index_internal(); }
+
+		// get the count of threads in worker, including customized threads
+		size_t get_thread_count() const noexcept {
+			return threads.size();
+		}
+
+		// get the count of waiting task
+		size_t get_task_count() const noexcept {
+			return task_count.load(std::memory_order_acquire);
+		}
+
+		// limit the count of running thread. e.g. 0 is not limited, 1 is to pause one thread from running, etc.
+		void limit(size_t count) noexcept {
+			limit_count = count;
+		}
+
+		// queue a task with an absolute deadline (milliseconds, in the domain of
+		// get_now_milliseconds). deadline tasks live in a separate lane that is
+		// polled ahead of the normal priority lanes only once their deadline is
+		// within the risk margin, so frame-budget work preempts batch work
+		// precisely instead of being over-prioritized all the time. tasks
+		// without deadlines are completely unaffected.
+		template <typename callable_t>
+		void queue_deadline(callable_t&& callable, size_t deadline_milliseconds) {
+			task_base_t* task = new_task(std::forward<callable_t>(callable));
+
+			std::lock_guard<std::mutex> guard(deadline_mutex);
+			iris_binary_insert(deadline_tasks, iris_make_key_value(deadline_milliseconds, task));
+			size_t nearest = nearest_deadline.load(std::memory_order_relaxed);
+			if (deadline_milliseconds < nearest) {
+				nearest_deadline.store(deadline_milliseconds, std::memory_order_release);
+			}
+
+			wakeup_one_with_priority(0);
+		}
+
+		// margin (milliseconds) before its deadline at which a task becomes
+		// urgent and preempts the normal lanes
+		void set_deadline_margin(size_t milliseconds) noexcept {
+			deadline_margin = milliseconds;
+		}
+
+		static size_t get_now_milliseconds() noexcept {
+			return now_milliseconds();
+		}
+
+		// promote tasks that stayed in lower-priority lists for at least the given
+		// residency time (in milliseconds) one level up, so background tasks keep
+		// bounded latency under sustained high-priority load. 0 disables aging.
+		void set_aging_interval(size_t milliseconds) noexcept {
+			aging_interval = milliseconds;
+			aging_timestamp.store(now_milliseconds(), std::memory_order_relaxed);
+		}
+
+		// queue a task to worker with given priority [0, thread_count - 1], which 0 is the highest priority
+		template <typename callable_t>
+		struct is_large_task {
+			static constexpr bool value = sizeof(task_t<callable_t>) > sizeof(task_t<void (*)()>);
+		};
+
+		template <typename callable_t>
+		typename std::enable_if<is_large_task<typename std::remove_reference<callable_t>::type>::value, task_base_t*>::type new_task(callable_t&& func) {
+			task_t<large_callable_t>* task = large_task_allocator.allocate(1);
+			new (task) task_t<large_callable_t>(std::forward<callable_t>(func), nullptr, ~(size_t)0);
+			task_count.fetch_add(1, std::memory_order_relaxed);
+
+			return task;
+		}
+
+		template <typename callable_t>
+		typename std::enable_if<!is_large_task<typename std::remove_reference<callable_t>::type>::value, task_base_t*>::type new_task(callable_t&& func) {
+			size_t index = task_allocator_index.fetch_add(1, std::memory_order_relaxed) % sub_allocator_count;
+			task_allocator_t& current_allocator = task_allocators[index];
+			task_t<callable_t>* task = reinterpret_cast<task_t<callable_t>*>(current_allocator.allocate(1));
+			static_assert(sizeof(task_t<callable_t>) == sizeof(task_t<void (*)()>), "Task size mismatch!");
+			new (task) task_t<callable_t>(std::forward<callable_t>(func), nullptr, index);
+			task_count.fetch_add(1, std::memory_order_relaxed);
+
+			return task;
+		}
+
+		// guard for exceptions on polling
+		struct poll_guard_t {
+			poll_guard_t(iris_async_worker_t& w, task_base_t* t) noexcept : worker(w), task(t) {}
+			~poll_guard_t() noexcept {
+				// do cleanup work
+				size_t index = task->alloc_index;
+
+				if (index == ~(size_t)0) {
+					worker.large_task_allocator.deallocate(static_cast<task_t<large_callable_t>*>(task), 1);
+				} else {
+					worker.task_allocators[index].deallocate(static_cast<task_t<void (*)()>*>(task), 1);
+				}
+
+				worker.task_count.fetch_sub(1, std::memory_order_release);
+			}
+
+			iris_async_worker_t& worker;
+			task_base_t* task;
+		};
+
+#if IRIS_ENABLE_STATS
+		static constexpr size_t latency_bucket_count = 24;
+
+		// log2-bucketed queue-to-execute latency histogram of one priority,
+		// bucket i counts tasks with latency in [2^i, 2^(i+1)) microseconds
+		struct latency_histogram_t {
+			size_t buckets[latency_bucket_count];
+		};
+
+		latency_histogram_t get_latency_histogram(size_t priority) const noexcept {
+			latency_histogram_t histogram;
+			std::memset(&histogram, 0, sizeof(histogram));
+
+			size_t lanes = latency_buckets.size() / latency_bucket_count;
+			if (lanes != 0) {
+				priority = std::min(priority, lanes - 1);
+				for (size_t i = 0; i < latency_bucket_count; i++) {
+					histogram.buckets[i] = latency_buckets[priority * latency_bucket_count + i].load(std::memory_order_relaxed);
+				}
+			}
+
+			return histogram;
+		}
+
+		// approximate latency (microseconds) at the given percentile [0, 100]
+		size_t get_latency_percentile(size_t priority, size_t percent) const noexcept {
+			latency_histogram_t histogram = get_latency_histogram(priority);
+			size_t total = 0;
+			for (size_t i = 0; i < latency_bucket_count; i++) {
+				total += histogram.buckets[i];
+			}
+
+			if (total == 0) {
+				return 0;
+			}
+
+			size_t threshold = total * std::min(percent, (size_t)100) / 100;
+			size_t accumulated = 0;
+			for (size_t i = 0; i < latency_bucket_count; i++) {
+				accumulated += histogram.buckets[i];
+				if (accumulated >= threshold) {
+					return (size_t)1 << i;
+				}
+			}
+
+			return (size_t)1 << (latency_bucket_count - 1);
+		}
+
+	protected:
+		static size_t now_microseconds() noexcept {
+			return iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		void init_latency_buckets() {
+			std::vector<std::atomic<size_t>> buckets(std::max(internal_thread_count, (size_t)1) * latency_bucket_count);
+			for (size_t i = 0; i < buckets.size(); i++) {
+				buckets[i].store(0, std::memory_order_relaxed);
+			}
+
+			latency_buckets = std::move(buckets);
+		}
+
+		void stat_mark_task(task_base_t* task, size_t priority) noexcept {
+			task->stat_timestamp = now_microseconds();
+			task->stat_priority = priority;
+		}
+
+		void stat_mark_task_chain(task_base_t* head, size_t priority) noexcept {
+			size_t timestamp = now_microseconds();
+			for (task_base_t* p = head; p != nullptr; p = p->next) {
+				p->stat_timestamp = timestamp;
+				p->stat_priority = priority;
+			}
+		}
+
+		void stat_record_latency(task_base_t* task) noexcept {
+			size_t lanes = latency_buckets.size() / latency_bucket_count;
+			if (lanes != 0 && task->stat_timestamp != 0) {
+				size_t latency = now_microseconds() - task->stat_timestamp;
+				size_t bucket = 0;
+				while (latency > 1 && bucket + 1 < latency_bucket_count) {
+					latency >>= 1;
+					bucket++;
+				}
+
+				size_t priority = std::min(task->stat_priority, lanes - 1);
+				latency_buckets[priority * latency_bucket_count + bucket].fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		std::vector<std::atomic<size_t>> latency_buckets; // [priority][log2 bucket]
+
+	public:
+#else
+	protected:
+		void init_latency_buckets() noexcept {}
+		void stat_mark_task(task_base_t*, size_t) noexcept {}
+		void stat_mark_task_chain(task_base_t*, size_t) noexcept {}
+		void stat_record_latency(task_base_t*) noexcept {}
+
+	public:
+#endif
+
+#if IRIS_ENABLE_REPLAY
+		// start recording the execution order of tasks into `log`: every task
+		// receives a submission-order sequence id and the order they actually
+		// execute in is appended to the log, cheap enough for production runs.
+		void record(std::vector<size_t>* log) noexcept {
+			replay_log = log;
+		}
+
+		// re-execute queued tasks single-threadedly in a previously recorded
+		// order, turning race-order-dependent bugs into deterministic cases.
+		// the worker should be set up with a dummy thread placeholder and no
+		// internal threads; tasks queued by replayed tasks join the pool with
+		// deterministic sequence ids. returns false when the schedule diverges
+		// (a recorded task never appeared).
+		bool replay(const std::vector<size_t>& log) {
+			make_current(0);
+
+			std::vector<task_base_t*> pending;
+			for (size_t i = 0; i < log.size(); i++) {
+				size_t sequence = log[i];
+
+				task_base_t* task = nullptr;
+				while (task == nullptr) {
+					// refill from the shared lists, then look the sequence up
+					for (size_t k = 0; k < task_heads.size(); k++) {
+						task_base_t* p = task_heads[k].exchange(nullptr, std::memory_order_acquire);
+						while (p != nullptr) {
+							task_base_t* q = p->next;
+							p->next = nullptr;
+							pending.emplace_back(p);
+							p = q;
+						}
+					}
+
+					size_t n;
+					for (n = 0; n < pending.size(); n++) {
+						if (pending[n]->replay_sequence == sequence) {
+							task = pending[n];
+							pending.erase(pending.begin() + n);
+							break;
+						}
+					}
 
-		// get the count of threads in worker, including customized threads
-		size_t get_thread_count() const noexcept {
-			return threads.size();
-		}
+					if (task == nullptr) {
+						make_current(~size_t(0));
+						return false; // diverged from the recording
+					}
+				}
 
-		// get the count of waiting task
-		size_t get_task_count() const noexcept {
-			return task_count.load(std::memory_order_acquire);
-		}
+				execute_task(task);
+			}
 
-		// limit the count of running thread. e.g. 0 is not limited, 1 is to pause one thread from running, etc.
-		void limit(size_t count) noexcept {
-			limit_count = count;
-		}
+			// drain leftovers, including tasks they queue
+			while (true) {
+				for (size_t k = 0; k < task_heads.size(); k++) {
+					task_base_t* p = task_heads[k].exchange(nullptr, std::memory_order_acquire);
+					while (p != nullptr) {
+						task_base_t* q = p->next;
+						p->next = nullptr;
+						pending.emplace_back(p);
+						p = q;
+					}
+				}
 
-		// queue a task to worker with given priority [0, thread_count - 1], which 0 is the highest priority
-		template <typename callable_t>
-		struct is_large_task {
-			static constexpr bool value = sizeof(task_t<callable_t>) > sizeof(task_t<void (*)()>);
-		};
+				if (pending.empty()) {
+					break;
+				}
 
-		template <typename callable_t>
-		typename std::enable_if<is_large_task<typename std::remove_reference<callable_t>::type>::value, task_base_t*>::type new_task(callable_t&& func) {
-			task_t<large_callable_t>* task = large_task_allocator.allocate(1);
-			new (task) task_t<large_callable_t>(std::forward<callable_t>(func), nullptr, ~(size_t)0);
-			task_count.fetch_add(1, std::memory_order_relaxed);
+				task_base_t* task = pending.front();
+				pending.erase(pending.begin());
+				execute_task(task);
+			}
 
-			return task;
+			make_current(~size_t(0));
+			return true;
 		}
 
-		template <typename callable_t>
-		typename std::enable_if<!is_large_task<typename std::remove_reference<callable_t>::type>::value, task_base_t*>::type new_task(callable_t&& func) {
-			size_t index = task_allocator_index.fetch_add(1, std::memory_order_relaxed) % sub_allocator_count;
-			task_allocator_t& current_allocator = task_allocators[index];
-			task_t<callable_t>* task = reinterpret_cast<task_t<callable_t>*>(current_allocator.allocate(1));
-			static_assert(sizeof(task_t<callable_t>) == sizeof(task_t<void (*)()>), "Task size mismatch!");
-			new (task) task_t<callable_t>(std::forward<callable_t>(func), nullptr, index);
-			task_count.fetch_add(1, std::memory_order_relaxed);
+	protected:
+		void replay_mark_task(task_base_t* task) noexcept {
+			task->replay_sequence = replay_counter.fetch_add(1, std::memory_order_relaxed);
+		}
 
-			return task;
+		void replay_mark_task_chain(task_base_t* head) noexcept {
+			for (task_base_t* p = head; p != nullptr; p = p->next) {
+				replay_mark_task(p);
+			}
 		}
 
-		// guard for exceptions on polling
-		struct poll_guard_t {
-			poll_guard_t(iris_async_worker_t& w, task_base_t* t) noexcept : worker(w), task(t) {}
-			~poll_guard_t() noexcept {
-				// do cleanup work
-				size_t index = task->alloc_index;
+		void replay_record_execution(task_base_t* task) {
+			if (replay_log != nullptr) {
+				std::lock_guard<std::mutex> guard(replay_mutex);
+				replay_log->emplace_back(task->replay_sequence);
+			}
+		}
 
-				if (index == ~(size_t)0) {
-					worker.large_task_allocator.deallocate(static_cast<task_t<large_callable_t>*>(task), 1);
-				} else {
-					worker.task_allocators[index].deallocate(static_cast<task_t<void (*)()>*>(task), 1);
-				}
+		std::atomic<size_t> replay_counter { 0 }; // next submission sequence id
+		std::vector<size_t>* replay_log = nullptr; // record sink, nullptr when off
+		std::mutex replay_mutex;
 
-				worker.task_count.fetch_sub(1, std::memory_order_release);
-			}
+	public:
+#else
+	protected:
+		void replay_mark_task(task_base_t*) noexcept {}
+		void replay_mark_task_chain(task_base_t*) noexcept {}
+		void replay_record_execution(task_base_t*) noexcept {}
 
-			iris_async_worker_t& worker;
-			task_base_t* task;
-		};
+	public:
+#endif
 
 		void execute_task(task_base_t* task) {
+			stat_record_latency(task);
+			replay_record_execution(task);
 			poll_guard_t guard(*this, task);
 			task->executor(task);
 		}
 
-		void queue_task(task_base_t* task, size_t priority = 0) {
+		// queue a task with given priority. affinity optionally names a preferred
+		// thread index: the task is then published to that thread's task_head slot,
+		// which is the first one scanned by threads whose index maps to the same
+		// duplicate slot. with task_head_duplicate_count set to the numa node count
+		// and threads enumerated so that thread_index % duplicate_count == node,
+		// tasks stay on their warp's node.
+		void queue_task(task_base_t* task, size_t priority = 0, size_t affinity = ~size_t(0)) {
 			IRIS_ASSERT(task != nullptr && task->next == nullptr);
 			if (!is_terminated()) {
 				IRIS_ASSERT(!threads.empty());
 				priority = std::min(priority, std::max(internal_thread_count, (size_t)1) - 1u);
+				stat_mark_task(task, priority);
+				replay_mark_task(task);
+
+				// in work-stealing mode, tasks queued from a pool thread go to its private deque first,
+				// unless an explicit placement elsewhere was requested; a hint naming
+				// the current thread is satisfied by the deque as well
+				if ((affinity == ~size_t(0) || affinity == get_current_thread_index()) && push_local_task<enable_work_stealing>(task)) {
+					wakeup_one_with_priority(priority);
+					return;
+				}
 
 				// try empty slots first
 				size_t index = 0;
 				ptrdiff_t max_diff = std::numeric_limits<ptrdiff_t>::min();
 				size_t thread_count = threads.size();
-				size_t current_thread_index = get_current_thread_index();
+				size_t current_thread_index = affinity != ~size_t(0) ? affinity : get_current_thread_index();
 				current_thread_index = current_thread_index == ~size_t(0) ? 0 : current_thread_index;
 
 				for (size_t n = 0; n < task_head_duplicate_count; n++) {
@@ -1367,8 +3040,70 @@ namespace iris {
 		}
 
 		template <typename callable_t>
-		void queue(callable_t&& callable, size_t priority = 0) {
-			queue_task(new_task(std::forward<callable_t>(callable)), priority);
+		void queue(callable_t&& callable, size_t priority = 0, size_t affinity = ~size_t(0)) {
+			queue_task(new_task(std::forward<callable_t>(callable)), priority, affinity);
+		}
+
+		// queue a batch of callables in [from, to) with given priority.
+		// all tasks are linked into a local chain first and published with a single
+		// atomic splice plus one notification, which is much cheaper than calling
+		// queue() once per task for bulk producers.
+		template <typename iterator_t>
+		void queue_batch(iterator_t from, iterator_t to, size_t priority = 0) {
+			if (from == to)
+				return;
+
+			// build the chain locally, no synchronization needed yet
+			task_base_t* head = new_task(*from);
+			task_base_t* tail = head;
+
+			while (++from != to) {
+				task_base_t* task = new_task(*from);
+				tail->next = task;
+				tail = task;
+			}
+
+			queue_task_batch(head, tail, priority);
+		}
+
+		// publish a locally built task chain [head, tail] at once
+		void queue_task_batch(task_base_t* head, task_base_t* tail, size_t priority = 0) {
+			IRIS_ASSERT(head != nullptr && tail != nullptr && tail->next == nullptr);
+
+			if (!is_terminated()) {
+				IRIS_ASSERT(!threads.empty());
+				priority = std::min(priority, std::max(internal_thread_count, (size_t)1) - 1u);
+				stat_mark_task_chain(head, priority);
+				replay_mark_task_chain(head);
+
+				// count the batch before publication, the chain is shared afterwards
+				size_t batch_count = 0;
+				for (task_base_t* p = head; p != nullptr && batch_count < threads.size(); p = p->next) {
+					batch_count++;
+				}
+
+				size_t thread_count = threads.size();
+				size_t current_thread_index = get_current_thread_index();
+				current_thread_index = current_thread_index == ~size_t(0) ? 0 : current_thread_index;
+				std::atomic<task_base_t*>& task_head = task_heads[priority + (current_thread_index % task_head_duplicate_count) * thread_count];
+
+				// avoid legacy compiler bugs
+				// see https://en.cppreference.com/w/cpp/atomic/atomic/compare_exchange
+				task_base_t* node = task_head.load(std::memory_order_relaxed);
+				do {
+					tail->next = node;
+				} while (!task_head.compare_exchange_weak(node, head, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+				// wake one thread per batched task, capped by the waiter count
+				wakeup_some_with_priority(priority, batch_count);
+			} else {
+				// terminate requested, chain to default task_head at 0
+				std::atomic<task_base_t*>& task_head = task_heads[0];
+				task_base_t* node = task_head.load(std::memory_order_relaxed);
+				do {
+					tail->next = node;
+				} while (!task_head.compare_exchange_weak(node, head, std::memory_order_acq_rel, std::memory_order_relaxed));
+			}
 		}
 
 		// mark as terminated
@@ -1401,7 +3136,27 @@ namespace iris {
 		bool join() {
 			IRIS_PROFILE_SCOPE(__FUNCTION__);
 
-			bool empty = true;
+			bool empty = join_local_tasks<enable_work_stealing>();
+
+			// drain the deadline lane as well
+			while (true) {
+				task_base_t* task = nullptr;
+				do {
+					std::lock_guard<std::mutex> guard(deadline_mutex);
+					if (!deadline_tasks.empty()) {
+						task = deadline_tasks.front().second;
+						deadline_tasks.erase(deadline_tasks.begin());
+						nearest_deadline.store(deadline_tasks.empty() ? ~size_t(0) : deadline_tasks.front().first, std::memory_order_release);
+					}
+				} while (false);
+
+				if (task == nullptr) {
+					break;
+				}
+
+				empty = false;
+				execute_task(task);
+			}
 			for (size_t i = 0; i < task_heads.size(); i++) {
 				std::atomic<task_base_t*>& task_head = task_heads[i];
 				task_base_t* task = task_head.exchange(nullptr, std::memory_order_acquire);
@@ -1452,9 +3207,22 @@ namespace iris {
 				std::unique_lock<std::mutex> lock(mutex);
 				waiting_guard_t guard(this);
 
-				if (fetch(threads.size()).first == ~size_t(0)) {
+				if (fetch(threads.size()).first == ~size_t(0) && !has_stealable_task<enable_work_stealing>()) {
 					if (!is_terminated()) {
-						condition.wait(lock);
+						// a pending deadline bounds the park so the lane fires on
+						// an otherwise idle pool once its deadline is at risk,
+						// instead of waiting for unrelated work to arrive
+						size_t nearest = nearest_deadline.load(std::memory_order_acquire);
+						if (nearest == ~size_t(0)) {
+							condition.wait(lock);
+						} else {
+							size_t now = now_milliseconds();
+							size_t wake_at = nearest > deadline_margin ? nearest - deadline_margin : 0;
+							if (wake_at > now) {
+								condition.wait_for(lock, std::chrono::milliseconds(wake_at - now));
+							}
+							// else: already at risk, return to polling right away
+						}
 					}
 				}
 			}
@@ -1470,12 +3238,39 @@ namespace iris {
 			return iris_static_instance_t<thread_index_t>::get_thread_local().value;
 		}
 
+		// threads sitting in blocking sections temporarily reduce the effective
+		// running-thread limit, see blocking_guard_t
+		size_t get_effective_limit_count() const noexcept {
+			size_t blocked = blocking_count.load(std::memory_order_relaxed);
+			return limit_count > blocked ? limit_count - blocked : 0;
+		}
+
 		void wakeup_one_with_priority(size_t priority) {
-			if (waiting_thread_count > priority + limit_count) {
+			if (waiting_thread_count > priority + get_effective_limit_count()) {
 				wakeup_one();
 			}
 		}
 
+		void wakeup_all_with_priority(size_t priority) {
+			if (waiting_thread_count > priority + get_effective_limit_count()) {
+				wakeup_all();
+			}
+		}
+
+		// wake only as many parked threads as there is work for: a batch of k
+		// tasks published to a pool with many more waiters used to notify_all
+		// and stampede every thread through a futile poll and back to sleep
+		void wakeup_some_with_priority(size_t priority, size_t count) {
+			size_t waiting = waiting_thread_count;
+			if (waiting > priority + get_effective_limit_count()) {
+				count = std::min(count, waiting);
+				std::lock_guard<std::mutex> lock(mutex);
+				for (size_t i = 0; i < count; i++) {
+					condition.notify_one();
+				}
+			}
+		}
+
 		// try fetching a task with given priority
 		std::pair<size_t, size_t> fetch(size_t priority_size) const noexcept {
 			size_t thread_count = threads.size();
@@ -1494,10 +3289,186 @@ namespace iris {
 			return std::make_pair(~size_t(0), ~size_t(0));
 		}
 
+		// initialize per-thread deques, only for work-stealing mode
+		template <bool enabled>
+		typename std::enable_if<enabled>::type init_task_deques() {
+			std::vector<impl::task_deque_t<task_base_t>> deques(threads.size());
+			task_deques = std::move(deques);
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled>::type init_task_deques() noexcept {}
+
+		// try pushing a task to current thread's private deque, returns false if not applicable
+		template <bool enabled>
+		typename std::enable_if<enabled, bool>::type push_local_task(task_base_t* task) noexcept {
+			size_t thread_index = get_current_thread_index();
+			return thread_index < task_deques.size() && task_deques[thread_index].push(task);
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled, bool>::type push_local_task(task_base_t* task) noexcept {
+			return false;
+		}
+
+		// pop a task from current thread's private deque (lifo)
+		template <bool enabled>
+		typename std::enable_if<enabled, task_base_t*>::type fetch_local_task() noexcept {
+			size_t thread_index = get_current_thread_index();
+			return thread_index < task_deques.size() ? task_deques[thread_index].pop() : nullptr;
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled, task_base_t*>::type fetch_local_task() noexcept {
+			return nullptr;
+		}
+
+		// steal a task from any other thread's deque (fifo)
+		template <bool enabled>
+		typename std::enable_if<enabled, task_base_t*>::type steal_task() noexcept {
+			size_t deque_count = task_deques.size();
+			size_t current_thread_index = get_current_thread_index();
+			current_thread_index = current_thread_index == ~size_t(0) ? 0 : current_thread_index;
+
+			for (size_t n = 1; n <= deque_count; n++) {
+				task_base_t* task = task_deques[(current_thread_index + n) % deque_count].steal();
+				if (task != nullptr) {
+					return task;
+				}
+			}
+
+			return nullptr;
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled, task_base_t*>::type steal_task() noexcept {
+			return nullptr;
+		}
+
+		// check if any private deque remains non-empty, so idle threads do not sleep over stealable tasks
+		template <bool enabled>
+		typename std::enable_if<enabled, bool>::type has_stealable_task() const noexcept {
+			for (size_t i = 0; i < task_deques.size(); i++) {
+				if (!task_deques[i].empty()) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled, bool>::type has_stealable_task() const noexcept {
+			return false;
+		}
+
+		// drain all private deques, used on joining
+		template <bool enabled>
+		typename std::enable_if<enabled, bool>::type join_local_tasks() {
+			bool empty = true;
+			for (size_t i = 0; i < task_deques.size(); i++) {
+				task_base_t* task;
+				while ((task = task_deques[i].steal()) != nullptr) {
+					empty = false;
+					execute_task(task);
+				}
+			}
+
+			return empty;
+		}
+
+		template <bool enabled>
+		typename std::enable_if<!enabled, bool>::type join_local_tasks() noexcept {
+			return true;
+		}
+
+		static size_t now_milliseconds() noexcept {
+			return iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// splice every non-empty lower-priority chain onto the list one level above,
+		// so the cost is O(priority levels), regardless of the task count
+		void age_tasks() {
+			size_t thread_count = threads.size();
+			for (size_t k = 0; k < task_head_duplicate_count; k++) {
+				for (size_t p = 1; p < internal_thread_count; p++) {
+					std::atomic<task_base_t*>& source = task_heads[p + k * thread_count];
+					if (source.load(std::memory_order_acquire) == nullptr)
+						continue;
+
+					task_base_t* chain = source.exchange(nullptr, std::memory_order_acquire);
+					if (chain == nullptr)
+						continue;
+
+					task_base_t* tail = chain;
+					while (tail->next != nullptr) {
+						tail = tail->next;
+					}
+
+					std::atomic<task_base_t*>& target = task_heads[(p - 1) + k * thread_count];
+					// avoid legacy compiler bugs
+					// see https://en.cppreference.com/w/cpp/atomic/atomic/compare_exchange
+					task_base_t* node = target.load(std::memory_order_relaxed);
+					do {
+						tail->next = node;
+					} while (!target.compare_exchange_weak(node, chain, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+					wakeup_one_with_priority(p - 1);
+				}
+			}
+		}
+
+		// perform an aging pass if the configured residency time elapsed,
+		// only one thread wins the timestamp race per interval
+		void try_age_tasks() {
+			if (aging_interval != 0) {
+				size_t now = now_milliseconds();
+				size_t last = aging_timestamp.load(std::memory_order_relaxed);
+				if (now - last >= aging_interval && aging_timestamp.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+					age_tasks();
+				}
+			}
+		}
+
+		// take the most urgent deadline task if its deadline is at risk,
+		// a single relaxed load on the fast path when the lane is idle
+		task_base_t* fetch_urgent_task() {
+			size_t nearest = nearest_deadline.load(std::memory_order_acquire);
+			if (nearest == ~size_t(0) || now_milliseconds() + deadline_margin < nearest) {
+				return nullptr;
+			}
+
+			std::lock_guard<std::mutex> guard(deadline_mutex);
+			if (deadline_tasks.empty()) {
+				return nullptr;
+			}
+
+			task_base_t* task = deadline_tasks.front().second;
+			deadline_tasks.erase(deadline_tasks.begin());
+			nearest_deadline.store(deadline_tasks.empty() ? ~size_t(0) : deadline_tasks.front().first, std::memory_order_release);
+			return task;
+		}
+
 		// poll with given priority
 		bool poll_internal(size_t priority_size) {
 			IRIS_PROFILE_SCOPE(__FUNCTION__);
 
+			try_age_tasks();
+
+			// deadline lane first, but only when at risk
+			task_base_t* urgent_task = fetch_urgent_task();
+			if (urgent_task != nullptr) {
+				execute_task(urgent_task);
+				return false;
+			}
+
+			// private deque goes first (lifo), keeping hot tasks on the submitting thread
+			task_base_t* local_task = fetch_local_task<enable_work_stealing>();
+			if (local_task != nullptr) {
+				execute_task(local_task);
+				return false;
+			}
+
 			std::pair<size_t, size_t> slot = fetch(priority_size);
 			size_t index = slot.first;
 
@@ -1536,6 +3507,13 @@ namespace iris {
 
 				return false;
 			} else {
+				// shared lists are empty, try stealing from other threads' deques (fifo)
+				task_base_t* stolen_task = steal_task<enable_work_stealing>();
+				if (stolen_task != nullptr) {
+					execute_task(stolen_task);
+					return false;
+				}
+
 				return true;
 			}
 		}
@@ -1548,12 +3526,237 @@ namespace iris {
 		std::atomic<size_t> running_count; // running_count
 		std::atomic<size_t> task_count; // the count of total waiting tasks 
 		std::vector<std::atomic<task_base_t*>> task_heads; // task pointer list
+		std::vector<impl::task_deque_t<task_base_t>> task_deques; // per-thread work-stealing deques, empty unless enable_work_stealing
 		std::mutex mutex; // mutex to protect condition
 		std::condition_variable condition; // condition variable for idle wait
 		std::atomic<size_t> terminated; // is to terminate
 		size_t waiting_thread_count; // thread count of waiting on condition variable
 		size_t limit_count; // limit the count of concurrently running thread
 		size_t internal_thread_count; // the count of internal thread
+		size_t spin_budget_limit; // max spin rounds in poll_delay before parking
+		std::atomic<size_t> spin_budget; // adaptive spin rounds, tracks recent task inter-arrival
+		size_t aging_interval; // task aging residency time in milliseconds, 0 disables aging
+		std::atomic<size_t> aging_timestamp; // timestamp of last aging pass
+		std::atomic<size_t> blocking_count; // threads currently inside blocking sections
+		std::mutex deadline_mutex; // protects deadline_tasks
+		std::vector<iris_key_value_t<size_t, task_base_t*>> deadline_tasks; // sorted by absolute deadline
+		std::atomic<size_t> nearest_deadline; // earliest pending deadline, ~0 when idle
+		size_t deadline_margin; // milliseconds before a deadline counts as at risk
+		std::function<void(size_t)> thread_affinity_handler; // invoked from each internal thread on start
+	};
+
+	// timer wheel for time-based scheduling on top of an async worker.
+	// arm() and cancel() are O(1); expirations beyond the wheel span carry a
+	// rounds counter and are revisited on later laps. the wheel must be
+	// serviced by calling tick() regularly, e.g. from a customized thread or
+	// around a poll_delay loop; fired callbacks are queued onto the worker
+	// with their arming priority.
+	template <typename async_worker_t, size_t wheel_size = 256>
+	struct iris_timer_wheel_t {
+		using callback_t = std::function<void()>;
+
+		iris_timer_wheel_t(async_worker_t& w, size_t tick_ms = 10) : worker(w), tick_interval(std::max(tick_ms, (size_t)1)), free_head(nullptr) {
+			for (size_t i = 0; i < wheel_size; i++) {
+				slots[i] = nullptr;
+			}
+
+			current_tick = now_milliseconds() / tick_interval;
+		}
+
+		~iris_timer_wheel_t() noexcept {
+			for (size_t i = 0; i < wheel_size; i++) {
+				release_chain(slots[i]);
+			}
+
+			release_chain(free_head);
+		}
+
+		struct timer_t {
+			callback_t callback;
+			size_t rounds;
+			size_t version;
+			size_t priority;
+			bool cancelled;
+			timer_t* next;
+		};
+
+		// versioned handle: stays safely cancelable even after the timer fired
+		// and its slot was recycled
+		struct handle_t {
+			timer_t* timer = nullptr;
+			size_t version = 0;
+		};
+
+		// arm a timer firing after the given delay, O(1)
+		template <typename callback_data_t>
+		handle_t arm(size_t delay_milliseconds, callback_data_t&& callback, size_t priority = 0) {
+			std::lock_guard<std::mutex> guard(lock);
+
+			timer_t* timer = free_head;
+			if (timer != nullptr) {
+				free_head = timer->next;
+			} else {
+				timer = new timer_t();
+				timer->version = 1;
+			}
+
+			size_t ticks = delay_milliseconds / tick_interval + 1;
+			timer->callback = std::forward<callback_data_t>(callback);
+			// the cursor first reaches the target slot after at most wheel_size
+			// ticks, so an exact multiple of wheel_size needs one round less
+			timer->rounds = (ticks - 1) / wheel_size;
+			timer->priority = priority;
+			timer->cancelled = false;
+
+			size_t slot = (current_tick + ticks) % wheel_size;
+			timer->next = slots[slot];
+			slots[slot] = timer;
+
+			handle_t handle;
+			handle.timer = timer;
+			handle.version = timer->version;
+			return handle;
+		}
+
+		// cancel an armed timer, O(1). returns false if it already fired.
+		bool cancel(const handle_t& handle) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (handle.timer != nullptr && handle.timer->version == handle.version && !handle.timer->cancelled) {
+				handle.timer->cancelled = true;
+				return true;
+			}
+
+			return false;
+		}
+
+		// advance the wheel to the current time and queue expired callbacks
+		void tick() {
+			std::vector<std::pair<callback_t, size_t>> fired;
+			do {
+				std::lock_guard<std::mutex> guard(lock);
+				size_t now_tick = now_milliseconds() / tick_interval;
+
+				while (current_tick < now_tick) {
+					current_tick++;
+					size_t cursor = current_tick % wheel_size;
+					timer_t* p = slots[cursor];
+					slots[cursor] = nullptr;
+
+					while (p != nullptr) {
+						timer_t* q = p->next;
+						if (p->cancelled) {
+							recycle(p);
+						} else if (p->rounds != 0) {
+							// not this lap, revisit later
+							p->rounds--;
+							p->next = slots[cursor];
+							slots[cursor] = p;
+						} else {
+							fired.emplace_back(std::move(p->callback), p->priority);
+							recycle(p);
+						}
+
+						p = q;
+					}
+				}
+			} while (false);
+
+			for (size_t i = 0; i < fired.size(); i++) {
+				worker.queue(std::move(fired[i].first), fired[i].second);
+			}
+		}
+
+		size_t get_tick_interval() const noexcept {
+			return tick_interval;
+		}
+
+		async_worker_t& get_async_worker() noexcept {
+			return worker;
+		}
+
+	protected:
+		static size_t now_milliseconds() noexcept {
+			return iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		void recycle(timer_t* timer) noexcept {
+			timer->version++;
+			timer->callback = callback_t();
+			timer->next = free_head;
+			free_head = timer;
+		}
+
+		static void release_chain(timer_t* p) noexcept {
+			while (p != nullptr) {
+				timer_t* q = p->next;
+				delete p;
+				p = q;
+			}
+		}
+
+	protected:
+		async_worker_t& worker;
+		std::mutex lock;
+		size_t tick_interval; // milliseconds per tick
+		size_t current_tick;
+		timer_t* slots[wheel_size];
+		timer_t* free_head; // recycled timers
+	};
+
+	// load-based auto-scaling on top of the worker's limit() machinery:
+	// provision max_threads at start and let the scaler park and unpark them.
+	// update() (driven from a maintenance tick, a timer wheel slot or a
+	// dedicated thread) unparks a thread whenever queue depth persists across
+	// updates and parks one again after the idle timeout, bounded by the
+	// configured min/max. parked threads cost only their stacks, and the
+	// termination protocol is untouched since the thread set never changes.
+	template <typename async_worker_t>
+	struct iris_async_scaler_t {
+		iris_async_scaler_t(async_worker_t& worker, size_t min_thread_count, size_t max_thread_count, size_t idle_timeout_ms = 200, size_t depth_threshold = 1)
+			: async_worker(worker), min_threads(std::max(min_thread_count, (size_t)1)), max_threads(max_thread_count), idle_timeout(idle_timeout_ms), queue_depth_threshold(std::max(depth_threshold, (size_t)1)) {
+			IRIS_ASSERT(min_threads <= max_threads);
+			parked = max_threads - min_threads;
+			busy_timestamp = now_milliseconds();
+			async_worker.limit(parked);
+		}
+
+		// threads currently allowed to run
+		size_t get_active_count() const noexcept {
+			return max_threads - parked;
+		}
+
+		// evaluate load and adjust the park count, call periodically
+		void update() {
+			size_t depth = async_worker.get_task_count();
+			size_t now = now_milliseconds();
+
+			if (depth >= queue_depth_threshold) {
+				busy_timestamp = now;
+				if (parked != 0) {
+					// demand persists, unpark one thread
+					async_worker.limit(--parked);
+					async_worker.wakeup_one();
+				}
+			} else if (depth == 0 && get_active_count() > min_threads && now - busy_timestamp >= idle_timeout) {
+				// idle long enough, park one thread again
+				async_worker.limit(++parked);
+				busy_timestamp = now;
+			}
+		}
+
+	protected:
+		static size_t now_milliseconds() noexcept {
+			return iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+	protected:
+		async_worker_t& async_worker;
+		size_t min_threads;
+		size_t max_threads;
+		size_t idle_timeout; // milliseconds of emptiness before parking one thread
+		size_t queue_depth_threshold; // pending tasks that count as sustained demand
+		size_t parked; // currently parked thread count, fed into limit()
+		size_t busy_timestamp; // last time demand was observed
 	};
 
 	template <typename async_worker_t>
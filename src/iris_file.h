@@ -0,0 +1,157 @@
+/*
+The Iris Concurrency Framework
+
+This software is a C++ 20 Header-Only reimplementation of core part from project PaintsNow.
+
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 PaintDream
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "iris_coroutine.h"
+#include "iris_buffer.h"
+#include <cstdio>
+
+namespace iris {
+	// asynchronous file layer: positioned reads and writes are serviced by a
+	// dedicated i/o worker (typically a small blocking sub-pool, see
+	// iris_blocking_t) and awaited from coroutines, which resume back on their
+	// warp with the transferred byte count. data lands straight in
+	// caller-provided storage such as iris_buffer_t/iris_cache_t slabs, no
+	// intermediate copies. plain positioned stdio is used underneath to keep
+	// this header portable; the i/o worker isolates the blocking calls from
+	// the compute pool just like io_uring/overlapped would.
+	template <typename io_worker_t>
+	struct iris_file_t {
+		explicit iris_file_t(io_worker_t& w) noexcept : io_worker(w), fp(nullptr) {}
+
+		iris_file_t(const iris_file_t&) = delete;
+		iris_file_t& operator = (const iris_file_t&) = delete;
+
+		~iris_file_t() noexcept {
+			close();
+		}
+
+		bool open(const char* path, const char* mode) {
+			IRIS_ASSERT(fp == nullptr);
+			fp = fopen(path, mode);
+			return fp != nullptr;
+		}
+
+		void close() noexcept {
+			if (fp != nullptr) {
+				fclose(fp);
+				fp = nullptr;
+			}
+		}
+
+		bool is_open() const noexcept {
+			return fp != nullptr;
+		}
+
+		size_t get_size() {
+			IRIS_ASSERT(fp != nullptr);
+			std::lock_guard<std::mutex> guard(file_mutex);
+			int64_t current = tell_position(fp);
+			seek_end(fp);
+			int64_t size = tell_position(fp);
+			seek_position(fp, iris_verify_cast<size_t>(current));
+			return iris_verify_cast<size_t>(size);
+		}
+
+		// co_await a positioned read into [data, data + size), returns the byte
+		// count actually read; the coroutine resumes on its original warp
+		template <typename warp_t>
+		auto read_at(size_t offset, uint8_t* data, size_t size) {
+			IRIS_ASSERT(fp != nullptr);
+			return iris_blocking<warp_t>(io_worker, [this, offset, data, size]() {
+				std::lock_guard<std::mutex> guard(file_mutex);
+				if (seek_position(fp, offset) != 0) {
+					return (size_t)0;
+				}
+
+				return fread(data, 1, size, fp);
+			});
+		}
+
+		// read straight into a buffer view, filling up to its current size
+		template <typename warp_t>
+		auto read_at(size_t offset, iris_bytes_t& buffer) {
+			return read_at<warp_t>(offset, buffer.get_data(), buffer.get_size());
+		}
+
+		// co_await a positioned write, returns the byte count actually written
+		template <typename warp_t>
+		auto write_at(size_t offset, const uint8_t* data, size_t size) {
+			IRIS_ASSERT(fp != nullptr);
+			return iris_blocking<warp_t>(io_worker, [this, offset, data, size]() {
+				std::lock_guard<std::mutex> guard(file_mutex);
+				if (seek_position(fp, offset) != 0) {
+					return (size_t)0;
+				}
+
+				size_t written = fwrite(data, 1, size, fp);
+				fflush(fp);
+				return written;
+			});
+		}
+
+		template <typename warp_t>
+		auto write_at(size_t offset, const iris_bytes_t& buffer) {
+			return write_at<warp_t>(offset, buffer.get_data(), buffer.get_size());
+		}
+
+	protected:
+		// 64-bit positioned io: the long-based fseek/ftell truncate at 2GB
+		// where long is 32 bits (LLP64 windows, 32-bit linux)
+		static int seek_position(FILE* fp, size_t offset) noexcept {
+#if defined(_WIN32)
+			return _fseeki64(fp, (long long)offset, SEEK_SET);
+#else
+			return fseeko(fp, (off_t)offset, SEEK_SET);
+#endif
+		}
+
+		static int seek_end(FILE* fp) noexcept {
+#if defined(_WIN32)
+			return _fseeki64(fp, 0, SEEK_END);
+#else
+			return fseeko(fp, 0, SEEK_END);
+#endif
+		}
+
+		static int64_t tell_position(FILE* fp) noexcept {
+#if defined(_WIN32)
+			return _ftelli64(fp);
+#else
+			return (int64_t)ftello(fp);
+#endif
+		}
+
+	protected:
+		io_worker_t& io_worker;
+		std::mutex file_mutex; // serializes positioned access on the shared FILE*
+		FILE* fp;
+	};
+}
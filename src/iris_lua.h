@@ -32,6 +32,7 @@ SOFTWARE.
 #include "iris_common.h"
 #include <array>
 #include <optional>
+#include <chrono>
 
 extern "C" {
 #if !USE_LUA_LIBRARY
@@ -636,9 +637,44 @@ namespace iris {
 			lua_pop(L, 1);
 		}
 
+		// fast path over make_object: the metatable interned by make_registry()
+		// is fetched with a single registry rawget on the static type hash, no
+		// temporary ref round-trip per construction.
 		template <typename type_t, typename... args_t>
 		refptr_t<type_t> make_registry_object(args_t&&... args) {
-			return make_object<type_t>(get_registry<ref_t>(reinterpret_cast<const void*>(get_hash<type_t>())), std::forward<args_t>(args)...);
+			IRIS_PROFILE_SCOPE(__FUNCTION__);
+
+			lua_State* L = state;
+			stack_guard_t guard(L);
+
+			if (!push_registry_metatable<type_t>(L)) {
+				return refptr_t<type_t>(LUA_REFNIL, nullptr);
+			}
+
+			static_assert(alignof(type_t) <= alignof(lua_Number), "Too large alignment for object holding.");
+			type_t* p = reinterpret_cast<type_t*>(lua_newuserdatauv(L, iris_to_alignment(sizeof(type_t), size_mask_alignment), get_metatable_uservalue_count(L, -1)));
+			new (p) type_t(std::forward<args_t>(args)...);
+			lua_pushvalue(L, -2);
+			lua_setmetatable(L, -2);
+			initialize_object(L, lua_absindex(L, -1), p);
+
+			refptr_t<type_t> ret(luaL_ref(L, LUA_REGISTRYINDEX), p);
+			lua_pop(L, 1); // metatable
+			return ret;
+		}
+
+		// check if the metatable of given type is interned to the registry,
+		// i.e. make_type().make_registry() has run for it
+		template <typename type_t>
+		bool is_registry_type_interned() {
+			lua_State* L = state;
+			stack_guard_t guard(L);
+
+			lua_pushlightuserdata(L, reinterpret_cast<void*>(get_hash<type_t>()));
+			lua_rawget(L, LUA_REGISTRYINDEX);
+			bool interned = lua_type(L, -1) == LUA_TTABLE;
+			lua_pop(L, 1);
+			return interned;
 		}
 
 		// make an object with given meta
@@ -660,10 +696,39 @@ namespace iris {
 			return refptr_t<type_t>(luaL_ref(L, LUA_REGISTRYINDEX), p);
 		}
 		
-		// make object view from registry meta
+		// make object view from registry meta, same single-rawget fast path
 		template <typename type_t>
 		refptr_t<type_t> make_registry_object_view(type_t* object) {
-			return make_object_view<type_t>(get_registry<ref_t>(reinterpret_cast<const void*>(get_hash<type_t>())), object);
+			IRIS_PROFILE_SCOPE(__FUNCTION__);
+			IRIS_ASSERT(object != nullptr);
+
+			lua_State* L = state;
+			stack_guard_t guard(L);
+
+			if (!push_registry_metatable<type_t>(L)) {
+				return refptr_t<type_t>(LUA_REFNIL, nullptr);
+			}
+
+			static_assert(sizeof(type_t*) == sizeof(void*), "Unrecognized architecture.");
+			size_t payload_size = 0;
+			if constexpr (has_lua_view_payload<type_t>::value) {
+				payload_size += iris_lua_traits_t<type_t>::type::lua_view_payload(iris_lua_t(L), object);
+			}
+
+			void* p = lua_newuserdatauv(L, (sizeof(type_t*) + payload_size) | size_mask_view, get_metatable_uservalue_count(L, -1));
+			*reinterpret_cast<type_t**>(p) = object;
+
+			lua_pushvalue(L, -2);
+			lua_setmetatable(L, -2);
+
+			// call lua_view_initialize if needed
+			if constexpr (has_lua_view_initialize<type_t>::value) {
+				iris_lua_traits_t<type_t>::type::lua_view_initialize(iris_lua_t(L), lua_absindex(L, -1), p);
+			}
+
+			refptr_t<type_t> ret(luaL_ref(L, LUA_REGISTRYINDEX), object);
+			lua_pop(L, 1); // metatable
+			return ret;
 		}
 
 		// make an object view with an exiting object
@@ -746,6 +811,32 @@ namespace iris {
 			return ref_t(luaL_ref(L, LUA_REGISTRYINDEX));
 		}
 
+		// pre-intern a field key: the returned pinned ref can be used as the key
+		// of ref_t::get/set and get_fields, which then push it with a cheap
+		// lua_rawgeti instead of re-hashing and re-interning the string on
+		// every access. remember to deref() it eventually.
+		ref_t intern(std::string_view key) {
+			return make_value(key);
+		}
+
+		// fetch several fields of one table in a single stack round trip,
+		// ideally with pre-interned keys:
+		//     auto values = lua.get_fields<int, float>(table, key_a, key_b);
+		template <typename... values_t, typename... keys_t>
+		std::tuple<values_t...> get_fields(const ref_t& table, keys_t&&... keys) {
+			static_assert(sizeof...(values_t) == sizeof...(keys_t), "one key per fetched value required!");
+			auto guard = write_fence();
+
+			lua_State* L = state;
+			stack_guard_t stack_guard(L);
+
+			push_variable(L, table);
+			std::tuple<values_t...> result;
+			get_fields_internal<0>(L, result, std::forward<keys_t>(keys)...);
+			lua_pop(L, 1);
+			return result;
+		}
+
 		// make ref from a given value
 		template <typename value_t>
 		ref_t make_value(value_t&& value) {
@@ -912,6 +1003,34 @@ namespace iris {
 			lua_rawset(L, -3);
 		}
 
+		// trusted fast-path registration for internal scripts: the same
+		// per-function specialized glue is pushed, but the per-call argument
+		// validation pass is skipped entirely and arguments are read with the
+		// raw accessors. keep the checked set_current/set_global for
+		// modding-facing APIs, malformed arguments here are undefined behavior.
+		template <auto ptr, typename key_t>
+		void set_current_unchecked(key_t&& key) {
+			auto guard = write_fence();
+
+			lua_State* L = state;
+			stack_guard_t stack_guard(L);
+
+			push_variable(L, std::forward<key_t>(key));
+			push_unchecked_internal<ptr>(L, ptr);
+			lua_rawset(L, -3);
+		}
+
+		template <auto ptr>
+		void set_global_unchecked(std::string_view key) {
+			auto guard = write_fence();
+
+			lua_State* L = state;
+			stack_guard_t stack_guard(L);
+
+			push_unchecked_internal<ptr>(L, ptr);
+			lua_setglobal(L, key.data());
+		}
+
 		template <typename value_t, typename key_t>
 		value_t get_current(key_t&& key) {
 			auto guard = write_fence();
@@ -1055,6 +1174,34 @@ namespace iris {
 			lua_pop(L, 1);
 		}
 
+		// transfer a value to a lua state owned by another warp without any
+		// serialization round-trip: a routine queued on the target warp
+		// deep-copies the ref via cross_transfer (tables, strings, bound
+		// userdata of registered types) and hands the resulting target-state ref
+		// to the callback. the source state must stay valid and unmutated until
+		// the callback ran, keep its warp suspended or idle meanwhile.
+		template <bool move, typename target_warp_t, typename callback_t>
+		void transfer(iris_lua_t target, target_warp_t& target_warp, ref_t&& value, callback_t&& callback) {
+			lua_State* S = state;
+			lua_State* T = target.get_state();
+			int ref_index = value.ref_index;
+			value.ref_index = LUA_REFNIL;
+
+			target_warp.queue_routine_post([S, T, ref_index, callback]() mutable {
+				iris_lua_t source(S);
+				iris_lua_t target_state(T);
+
+				ref_t value(ref_index);
+				source.native_push_variable(std::move(value));
+				source.template native_cross_transfer_variable<move>(target_state, -1);
+				source.native_pop_variable(1);
+
+				ref_t result = target_state.native_get_variable<ref_t>(-1);
+				target_state.native_pop_variable(1);
+				callback(target_state, std::move(result));
+			});
+		}
+
 		template <typename callable_t>
 		optional_result_t<int> native_call(callable_t&& reference, int param_count) {
 			IRIS_PROFILE_SCOPE(__FUNCTION__);
@@ -1106,13 +1253,155 @@ namespace iris {
 			}
 		}
 
+		// run incremental gc steps until the collector finishes a cycle or the
+		// time budget (in microseconds) is exhausted, whichever comes first.
+		// returns true when a full cycle completed. pairs with queue_gc() to keep
+		// memory flat without stop-the-world collections on a script warp.
+		bool gc_step(size_t step_size_kb, size_t budget_microseconds) {
+			auto guard = write_fence();
+			lua_State* L = state;
+
+			auto start = std::chrono::steady_clock::now();
+			do {
+				if (lua_gc(L, LUA_GCSTEP, (int)step_size_kb) == 1) {
+					return true; // cycle finished
+				}
+			} while (iris_verify_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()) < budget_microseconds);
+
+			return false;
+		}
+
+		// cooperative gc pacing on a warp: queues a routine that runs one bounded
+		// gc_step slice and requeues itself at the back of the warp's queue while
+		// the collector has outstanding work, so script tasks interleave with gc
+		// instead of hitching on full collections. the lua state must stay alive
+		// until the cycle completes.
+		template <typename warp_t>
+		void queue_gc(warp_t& warp, size_t step_size_kb = 64, size_t budget_microseconds = 500) {
+			warp.queue_routine_post(gc_task_t<warp_t>{ state, &warp, step_size_kb, budget_microseconds });
+		}
+
 	protected:
+		template <typename warp_t>
+		struct gc_task_t {
+			void operator () () {
+				if (!iris_lua_t(L).gc_step(step_size_kb, budget_microseconds)) {
+					warp->queue_routine_post(gc_task_t(*this));
+				}
+			}
+
+			lua_State* L;
+			warp_t* warp;
+			size_t step_size_kb;
+			size_t budget_microseconds;
+		};
+
+		template <size_t index, typename tuple_t, typename key_t, typename... keys_t>
+		static void get_fields_internal(lua_State* L, tuple_t& result, key_t&& key, keys_t&&... keys) {
+			push_variable(L, std::forward<key_t>(key));
+			lua_rawget(L, -2);
+			std::get<index>(result) = get_variable<std::tuple_element_t<index, tuple_t>>(L, -1);
+			lua_pop(L, 1);
+
+			get_fields_internal<index + 1>(L, result, std::forward<keys_t>(keys)...);
+		}
+
+		template <size_t index, typename tuple_t>
+		static void get_fields_internal(lua_State*, tuple_t&) noexcept {}
+
+		// push the metatable interned for type_t with one registry rawget,
+		// returns false (stack balanced) when the type was never interned
+		template <typename type_t>
+		static bool push_registry_metatable(lua_State* L) {
+			lua_pushlightuserdata(L, reinterpret_cast<void*>(get_hash<type_t>()));
+			lua_rawget(L, LUA_REGISTRYINDEX);
+			if (lua_type(L, -1) != LUA_TTABLE) {
+				lua_pop(L, 1);
+				return false;
+			}
+
+#if IRIS_DEBUG
+			lua_pushliteral(L, "__hash");
+			lua_rawget(L, -2);
+			IRIS_ASSERT(lua_touserdata(L, -1) == reinterpret_cast<void*>(get_hash<type_t>()));
+			lua_pop(L, 1);
+#endif
+			return true;
+		}
+
+		static int get_metatable_uservalue_count(lua_State* L, int index) {
+			lua_pushliteral(L, "__uservalue");
+			lua_rawget(L, index > 0 ? index : index - 1);
+			int count = (int)lua_tointeger(L, -1);
+			lua_pop(L, 1);
+			return count;
+		}
+
 		template <typename type_t>
 		using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<type_t>>;
 
 		template <typename type_t>
 		using cast_arg_type_t = std::conditional_t<has_lua_registar<remove_cvref_t<type_t>>::value, remove_cvref_t<type_t>&, remove_cvref_t<type_t>>;
-		
+
+	public:
+		// compile-time zero-allocation audit for bound signatures. the marshaling
+		// thunks are already specialized per function at registration time and
+		// read arguments straight off the lua stack; whether a call stays heap
+		// free then depends only on the argument and return types. place
+		// static_assert(iris_lua_t::is_zero_alloc<&func>, "...") next to the
+		// registration to flag signatures that would force an allocation per
+		// call (std::string copies, container conversions, optional_result_t
+		// error strings, ...).
+		template <typename type_t>
+		struct is_zero_alloc_type {
+			template <typename value_t, typename = void>
+			struct check_inner : std::true_type {};
+
+			template <typename value_t>
+			struct check_inner<value_t, iris_void_t<typename value_t::required_type_t>> : is_zero_alloc_type<typename value_t::required_type_t> {};
+
+			using value_t = remove_cvref_t<type_t>;
+			static constexpr bool value = std::is_void_v<value_t>
+				|| std::is_arithmetic_v<value_t>
+				|| std::is_enum_v<value_t>
+				|| std::is_pointer_v<value_t>
+				|| std::is_null_pointer_v<value_t>
+				|| std::is_same_v<value_t, std::string_view>
+				|| std::is_same_v<value_t, iris_lua_t>
+				|| std::is_base_of_v<ref_t, value_t>
+				|| iris_is_reference_wrapper<value_t>::value
+				|| (std::is_base_of_v<required_base_t, value_t> && check_inner<value_t>::value)
+				|| (std::is_reference_v<type_t> && has_lua_registar<value_t>::value); // registered objects resolve to userdata pointers
+		};
+
+		template <typename signature_t>
+		struct is_zero_alloc_function : std::false_type {};
+
+		template <typename return_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (*)(args_t...)> {
+			static constexpr bool value = is_zero_alloc_type<return_t>::value && (is_zero_alloc_type<args_t>::value && ...);
+		};
+
+		template <typename return_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (*)(args_t...) noexcept> : is_zero_alloc_function<return_t (*)(args_t...)> {};
+
+		template <typename return_t, typename type_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (type_t::*)(args_t...)> : is_zero_alloc_function<return_t (*)(args_t...)> {};
+
+		template <typename return_t, typename type_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (type_t::*)(args_t...) noexcept> : is_zero_alloc_function<return_t (*)(args_t...)> {};
+
+		template <typename return_t, typename type_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (type_t::*)(args_t...) const> : is_zero_alloc_function<return_t (*)(args_t...)> {};
+
+		template <typename return_t, typename type_t, typename... args_t>
+		struct is_zero_alloc_function<return_t (type_t::*)(args_t...) const noexcept> : is_zero_alloc_function<return_t (*)(args_t...)> {};
+
+		template <auto function>
+		static constexpr bool is_zero_alloc = is_zero_alloc_function<decltype(function)>::value;
+
+	protected:
+
 		// wrap a member function with normal function
 		template <auto method, typename return_t, typename type_t, typename... args_t>
 		static return_t method_function_adapter(required_t<type_t*>&& object, args_t&&... args) {
@@ -1213,6 +1502,37 @@ namespace iris {
 			lua_pushcfunction(L, ptr);
 		}
 
+		// unchecked registration, free functions and methods without envs
+		template <auto function, typename return_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (*)(args_t...)) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<function, return_t, 0, false, false, args_t...>));
+		}
+
+		template <auto function, typename return_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (*)(args_t...) noexcept) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<function, return_t, 0, false, false, args_t...>));
+		}
+
+		template <auto method, typename return_t, typename type_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (type_t::*)(args_t...)) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<method_function_adapter<method, return_t, type_t, args_t...>, return_t, 0, true, false, required_t<type_t*>&&, args_t...>));
+		}
+
+		template <auto method, typename return_t, typename type_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (type_t::*)(args_t...) noexcept) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<method_function_adapter<method, return_t, type_t, args_t...>, return_t, 0, true, false, required_t<type_t*>&&, args_t...>));
+		}
+
+		template <auto method, typename return_t, typename type_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (type_t::*)(args_t...) const) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<method_function_adapter<method, return_t, type_t, args_t...>, return_t, 0, true, false, required_t<type_t*>&&, args_t...>));
+		}
+
+		template <auto method, typename return_t, typename type_t, typename... args_t>
+		static void push_unchecked_internal(lua_State* L, return_t (type_t::*)(args_t...) const noexcept) {
+			lua_pushcfunction(L, (&iris_lua_t::function_proxy<method_function_adapter<method, return_t, type_t, args_t...>, return_t, 0, true, false, required_t<type_t*>&&, args_t...>));
+		}
+
 		// four specs for [const][noexcept] method definition
 		template <auto method, typename object_t, typename return_t, typename type_t, typename... args_t, typename... envs_t>
 		static void push_method(lua_State* L, object_t&& object, return_t(type_t::*)(args_t...), envs_t&&... envs) {
@@ -1269,7 +1589,7 @@ namespace iris {
 			if constexpr (iris_is_coroutine<return_t>::value) {
 				lua_pushcclosure(L, &iris_lua_t::function_coroutine_proxy<function, return_t, sizeof...(envs), use_this, args_t...>, sizeof...(envs));
 			} else {
-				lua_pushcclosure(L, &iris_lua_t::function_proxy<function, return_t, sizeof...(envs), use_this, args_t...>, sizeof...(envs));
+				lua_pushcclosure(L, &iris_lua_t::function_proxy<function, return_t, sizeof...(envs), use_this, true, args_t...>, sizeof...(envs));
 			}
 		}
 
@@ -1290,7 +1610,7 @@ namespace iris {
 			if constexpr (iris_is_coroutine<return_t>::value) {
 				lua_pushcclosure(L, &iris_lua_t::function_coroutine_proxy<function, return_t, 0, false, iris_lua_t, args_t...>, 1);
 			} else {
-				lua_pushcclosure(L, &iris_lua_t::function_proxy<function, return_t, 0, false, iris_lua_t, args_t...>, 1);
+				lua_pushcclosure(L, &iris_lua_t::function_proxy<function, return_t, 0, false, true, iris_lua_t, args_t...>, 1);
 			}
 		}
 		
@@ -1338,7 +1658,7 @@ namespace iris {
 			if constexpr (iris_is_coroutine<return_t>::value) {
 				return function_coroutine_proxy_dispatch<decltype(adapter), return_t, 0, true, required_t<type_t*>&&, args_t...>(L, adapter);
 			} else {
-				return function_proxy_dispatch<decltype(adapter), return_t, 0, true, required_t<type_t*>&&, args_t...>(L, adapter);
+				return function_proxy_dispatch<decltype(adapter), return_t, 0, true, true, required_t<type_t*>&&, args_t...>(L, adapter);
 			}			
 		}
 
@@ -1357,7 +1677,7 @@ namespace iris {
 			if constexpr (iris_is_coroutine<return_t>::value) {
 				return function_coroutine_proxy_dispatch<function_t, return_t, 0, false, args_t...>(L, function);
 			} else {
-				return function_proxy_dispatch<function_t, return_t, 0, false, args_t...>(L, function);
+				return function_proxy_dispatch<function_t, return_t, 0, false, true, args_t...>(L, function);
 			}
 		}
 
@@ -1862,9 +2182,11 @@ namespace iris {
 			check_required_parameters<env_count, up_base, use_this, index + (std::is_same_v<iris_lua_t, remove_cvref_t<type_t>> ? 0 : 1), args_t...>(L);
 		}
 
-		template <typename function_t, typename return_t, size_t env_count, bool use_this, typename... args_t>
+		template <typename function_t, typename return_t, size_t env_count, bool use_this, bool checked, typename... args_t>
 		static int function_proxy_dispatch(lua_State* L, const function_t& function) {
-			check_required_parameters<env_count, 0, use_this, 1, args_t...>(L);
+			if constexpr (checked) {
+				check_required_parameters<env_count, 0, use_this, 1, args_t...>(L);
+			}
 
 			int ret = function_invoke<function_t, 0, return_t, env_count, use_this, std::tuple<cast_arg_type_t<args_t>...>>(L, function, 1);
 			if (ret < 0) {
@@ -1875,9 +2197,9 @@ namespace iris {
 			return ret;
 		}
 
-		template <auto function, typename return_t, size_t env_count, bool use_this, typename... args_t>
+		template <auto function, typename return_t, size_t env_count, bool use_this, bool checked, typename... args_t>
 		static int function_proxy(lua_State* L) {
-			return function_proxy_dispatch<decltype(function), return_t, env_count, use_this, args_t...>(L, function);
+			return function_proxy_dispatch<decltype(function), return_t, env_count, use_this, checked, args_t...>(L, function);
 		}
 
 		static constexpr int coroutine_state_yield = -1;
@@ -0,0 +1,79 @@
+/*
+The Iris Concurrency Framework
+
+This software is a C++ 17 Header-Only reimplementation of core part from project PaintsNow.
+
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 PaintDream
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "iris_lua.h"
+#include "iris_buffer.h"
+
+namespace iris {
+	// zero-copy bridge between lua strings and iris_bytes_t: a bound function
+	// declaring an iris_bytes_t parameter receives a view aliasing the
+	// lua-owned string bytes for the duration of the call, with no
+	// lua_tolstring copy into fresh storage. slices stay O(1) via make_view on
+	// the received view. returning bytes to lua pushes one interned lua string
+	// (lua must own its strings), assembling chained views without an extra
+	// linearize pass.
+	template <>
+	struct iris_lua_traits_t<iris_bytes_t> : std::true_type {
+		using type = iris_lua_traits_t<iris_bytes_t>;
+
+		static iris_bytes_t from_lua(lua_State* L, int index) noexcept {
+			size_t length = 0;
+			const char* data = lua_tolstring(L, index, &length);
+			if (data == nullptr) {
+				return iris_bytes_t();
+			}
+
+			// alias lua-owned memory, valid until the call returns
+			return iris_bytes_t::make_view(reinterpret_cast<const uint8_t*>(data), length);
+		}
+
+		static int to_lua(lua_State* L, iris_bytes_t&& bytes) noexcept {
+			if (bytes.is_view_storage()) {
+				// assemble segments directly into lua's string buffer
+				luaL_Buffer buff;
+				luaL_buffinit(L, &buff);
+				bytes.for_each_segment([&buff](const uint8_t* data, size_t length) {
+					luaL_addlstring(&buff, reinterpret_cast<const char*>(data), length);
+				});
+
+				luaL_pushresult(&buff);
+			} else {
+				lua_pushlstring(L, reinterpret_cast<const char*>(bytes.get_data()), bytes.get_size());
+			}
+
+			return 1;
+		}
+
+		static bool lua_check(iris_lua_t lua, int index, void*) noexcept {
+			return lua_type(lua.get_state(), index) == LUA_TSTRING;
+		}
+	};
+}
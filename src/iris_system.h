@@ -69,10 +69,15 @@ namespace iris {
 		void dummy(iterators_t&&...) {}
 
 		template <typename iterators_t, size_t... i>
-		void step_iterators(iterators_t& iterators, size_t count) {
+		void step_iterators_impl(iterators_t& iterators, size_t count, iris_sequence<i...>) {
 			dummy(std::get<i>(iterators) += static_cast<ptrdiff_t>(count)...);
 		}
 
+		template <typename iterators_t>
+		void step_iterators(iterators_t& iterators, size_t count) {
+			step_iterators_impl(iterators, count, iris_make_sequence<std::tuple_size<iterators_t>::value>());
+		}
+
 		template <typename iterators_t, typename operation_t, size_t... i>
 		static void do_operation(iterators_t& iterators, operation_t& op, iris_sequence<i...>) {
 			op(*std::get<i>(iterators)++...);
@@ -84,6 +89,219 @@ namespace iris {
 		}
 	}
 
+	// tuple-like component marker for soa storage: declare a component of
+	// iris_system_t as iris_soa_t<float, float, ...> and each field is stored in
+	// its own parallel queue_list, so per-field iteration sees contiguous lanes
+	// that autovectorize, while element access reconstitutes a tuple of references.
+	template <typename... fields_t>
+	struct iris_soa_t : std::tuple<fields_t...> {
+		using std::tuple<fields_t...>::tuple;
+	};
+
+	// soa counterpart of iris_queue_list_t: one queue_list per field, kept in
+	// lockstep so a single index addresses all fields of one element.
+	template <template <typename...> class allocator_t, typename... fields_t>
+	struct iris_soa_queue_list_t {
+		using element_t = iris_soa_t<fields_t...>;
+		using reference_t = std::tuple<fields_t&...>;
+		using const_reference_t = std::tuple<const fields_t&...>;
+		using field_lists_t = std::tuple<iris_queue_list_t<fields_t, allocator_t>...>;
+
+		iris_soa_queue_list_t() {}
+
+		template <typename alloc_t>
+		explicit iris_soa_queue_list_t(const alloc_t& alloc) : field_lists(iris_queue_list_t<fields_t, allocator_t>(alloc)...) {}
+
+		// direct access to one field's lanes, for simd-style per-field scans
+		template <size_t index>
+		typename std::tuple_element<index, field_lists_t>::type& field() noexcept {
+			return std::get<index>(field_lists);
+		}
+
+		template <size_t index>
+		const typename std::tuple_element<index, field_lists_t>::type& field() const noexcept {
+			return std::get<index>(field_lists);
+		}
+
+		template <typename input_element_t>
+		void push(input_element_t&& element) {
+			push_impl(std::forward<input_element_t>(element), iris_make_sequence<sizeof...(fields_t)>());
+		}
+
+		void pop() noexcept {
+			pop_impl(placeholder<fields_t...>());
+		}
+
+		void clear() noexcept {
+			clear_impl(placeholder<fields_t...>());
+		}
+
+		reference_t top() noexcept {
+			return top_impl(iris_make_sequence<sizeof...(fields_t)>());
+		}
+
+		reference_t get(size_t index) noexcept {
+			return get_impl(index, iris_make_sequence<sizeof...(fields_t)>());
+		}
+
+		size_t size() const noexcept {
+			return std::get<0>(field_lists).size();
+		}
+
+		bool empty() const noexcept {
+			return std::get<0>(field_lists).empty();
+		}
+
+		size_t begin_index() const noexcept {
+			return std::get<0>(field_lists).begin_index();
+		}
+
+		size_t end_index() const noexcept {
+			return std::get<0>(field_lists).end_index();
+		}
+
+		struct iterator {
+			using difference_type = ptrdiff_t;
+			using value_type = reference_t;
+			using reference = reference_t;
+			using pointer = void;
+			using iterator_category = std::forward_iterator_tag;
+			using field_iterators_t = std::tuple<typename iris_queue_list_t<fields_t, allocator_t>::iterator...>;
+
+			iterator() {}
+			explicit iterator(field_iterators_t&& its) noexcept : field_iterators(std::move(its)) {}
+
+			iterator& operator ++ () noexcept {
+				step_impl(iris_make_sequence<sizeof...(fields_t)>());
+				return *this;
+			}
+
+			iterator operator ++ (int) noexcept {
+				iterator r = *this;
+				step_impl(iris_make_sequence<sizeof...(fields_t)>());
+				return r;
+			}
+
+			iterator& operator += (ptrdiff_t count) noexcept {
+				advance_impl(count, iris_make_sequence<sizeof...(fields_t)>());
+				return *this;
+			}
+
+			ptrdiff_t operator - (const iterator& rhs) const noexcept {
+				return std::get<0>(field_iterators) - std::get<0>(rhs.field_iterators);
+			}
+
+			bool operator == (const iterator& rhs) const noexcept {
+				return std::get<0>(field_iterators) == std::get<0>(rhs.field_iterators);
+			}
+
+			bool operator != (const iterator& rhs) const noexcept {
+				return std::get<0>(field_iterators) != std::get<0>(rhs.field_iterators);
+			}
+
+			reference_t operator * () const noexcept {
+				return deref_impl(iris_make_sequence<sizeof...(fields_t)>());
+			}
+
+		protected:
+			template <size_t... i>
+			void step_impl(iris_sequence<i...>) noexcept {
+				dummy(++std::get<i>(field_iterators)...);
+			}
+
+			template <size_t... i>
+			void advance_impl(ptrdiff_t count, iris_sequence<i...>) noexcept {
+				dummy(std::get<i>(field_iterators) += count...);
+			}
+
+			template <size_t... i>
+			reference_t deref_impl(iris_sequence<i...>) const noexcept {
+				return reference_t(*std::get<i>(field_iterators)...);
+			}
+
+			field_iterators_t field_iterators;
+		};
+
+		iterator begin() noexcept {
+			return begin_impl(iris_make_sequence<sizeof...(fields_t)>());
+		}
+
+		iterator end() noexcept {
+			return end_impl(iris_make_sequence<sizeof...(fields_t)>());
+		}
+
+		// iterate all elements, op receives one reference per field
+		template <typename operation_t>
+		void for_each(operation_t&& op) {
+			for (iterator p = begin(); p != end(); ++p) {
+				for_each_impl(op, *p, iris_make_sequence<sizeof...(fields_t)>());
+			}
+		}
+
+	protected:
+		template <typename input_element_t, size_t... i>
+		void push_impl(input_element_t&& element, iris_sequence<i...>) {
+			dummy((std::get<i>(field_lists).push(std::get<i>(std::forward<input_element_t>(element))), 0)...);
+		}
+
+		template <typename first_t, typename... remaining_t>
+		void pop_impl(placeholder<first_t, remaining_t...>) noexcept {
+			std::get<sizeof...(fields_t) - sizeof...(remaining_t) - 1>(field_lists).pop();
+			pop_impl(placeholder<remaining_t...>());
+		}
+
+		void pop_impl(placeholder<>) noexcept {}
+
+		template <typename first_t, typename... remaining_t>
+		void clear_impl(placeholder<first_t, remaining_t...>) noexcept {
+			std::get<sizeof...(fields_t) - sizeof...(remaining_t) - 1>(field_lists).clear();
+			clear_impl(placeholder<remaining_t...>());
+		}
+
+		void clear_impl(placeholder<>) noexcept {}
+
+		template <size_t... i>
+		reference_t top_impl(iris_sequence<i...>) noexcept {
+			return reference_t(std::get<i>(field_lists).top()...);
+		}
+
+		template <size_t... i>
+		reference_t get_impl(size_t index, iris_sequence<i...>) noexcept {
+			return reference_t(std::get<i>(field_lists).get(index)...);
+		}
+
+		template <size_t... i>
+		iterator begin_impl(iris_sequence<i...>) noexcept {
+			return iterator(typename iterator::field_iterators_t(std::get<i>(field_lists).begin()...));
+		}
+
+		template <size_t... i>
+		iterator end_impl(iris_sequence<i...>) noexcept {
+			return iterator(typename iterator::field_iterators_t(std::get<i>(field_lists).end()...));
+		}
+
+		template <typename operation_t, size_t... i>
+		static void for_each_impl(operation_t& op, reference_t refs, iris_sequence<i...>) {
+			op(std::get<i>(refs)...);
+		}
+
+		field_lists_t field_lists;
+	};
+
+	// tag allocator selecting inline small-vector storage for the entity index
+	// of small iris_system_t instances: pass it (via a single-parameter alias)
+	// as the vector_allocator_t parameter and entity_components lives inside
+	// the system object until it grows beyond `capacity` entities.
+	// notice that such systems cannot be attached to iris_systems_t, which
+	// expects std::vector-backed entity indices.
+	template <typename element_t, size_t capacity>
+	struct iris_inline_storage_allocator_t : std::allocator<element_t> {
+		static constexpr size_t inline_capacity = capacity;
+
+		template <typename morph_t>
+		struct rebind { using other = iris_inline_storage_allocator_t<morph_t, capacity>; };
+	};
+
 	// components_t is not allowed to contain repeated types
 	template <typename entity_t, template <typename...> class allocator_t, template <typename...> class vector_allocator_t = std::allocator, typename... components_t>
 	struct iris_system_t : protected enable_read_write_fence_t<> {
@@ -93,6 +311,13 @@ namespace iris {
 		using index_t = entity_t; // just for alignment
 		using components_tuple_t = std::tuple<entity_t, components_t...>;
 
+		// storage selection: soa-declared components get per-field parallel lists
+		template <typename component_t>
+		struct component_storage : std::enable_if<true, iris_queue_list_t<component_t, allocator_t>> {};
+
+		template <typename... fields_t>
+		struct component_storage<iris_soa_t<fields_t...>> : std::enable_if<true, iris_soa_queue_list_t<allocator_t, fields_t...>> {};
+
 		iris_system_t() {
 			// check if there are duplicated types
 			static_assert(check_duplicated_components<entity_t, components_t...>(), "duplicated entity/component detected!");
@@ -107,7 +332,7 @@ namespace iris {
 		// entity-based component insertion
 		bool valid(entity_t entity) const noexcept {
 			auto guard = read_fence();
-			return iris_binary_find(entity_components.begin(), entity_components.end(), entity) != entity_components.end();
+			return find_index(entity) != ~(index_t)0;
 		}
 
 		// returns true if the existing entity was replaced, or false if new entity was created
@@ -122,6 +347,7 @@ namespace iris {
 					index = iris_verify_cast<index_t>(entities.end_index());
 					replace_components<sizeof...(components_t)>(index, std::forward<elements_t>(t)...);
 					iterator->second = index;
+					set_index(entity, index);
 				} else {
 					replace_components<sizeof...(components_t)>(index, std::forward<elements_t>(t)...);
 				}
@@ -132,14 +358,69 @@ namespace iris {
 					entity_components.reserve(entity_components.size() * 3 / 2);
 				}
 
+				index_t index = iris_verify_cast<index_t>(entities.end_index());
 				emplace_components<sizeof...(components_t)>(std::forward<elements_t>(t)...);
-				iris_binary_insert(entity_components, iris_make_key_value(entity, iris_verify_cast<index_t>(entities.end_index())));
+				iris_binary_insert(entity_components, iris_make_key_value(entity, index));
 				entities.push(entity);
+				set_index(entity, index);
+				modify_version++;
 
 				return false;
 			}
 		}
 
+		// bulk insert a sorted run of new entities with parallel component
+		// ranges (one iterator per component, in declaration order): storage is
+		// appended in order and the sorted entity index is rebuilt by a single
+		// backward merge pass with one temporary allocation, instead of
+		// per-entity binary inserts shifting the vector repeatedly.
+		// entities must be sorted, unique and not present yet.
+		template <typename entity_iterator_t, typename... component_iterators_t>
+		void insert_batch(entity_iterator_t begin, entity_iterator_t end, component_iterators_t... component_begins) {
+			static_assert(sizeof...(component_iterators_t) == sizeof...(components_t), "one component iterator per component required!");
+			auto guard = write_fence();
+
+			size_t count = iris_verify_cast<size_t>(std::distance(begin, end));
+			if (count == 0) {
+				return;
+			}
+
+			size_t old_size = entity_components.size();
+			entity_components.resize(old_size + count);
+
+			// append entities and components in order, recording new index pairs at the tail
+			index_t index = iris_verify_cast<index_t>(entities.end_index());
+			size_t k = 0;
+			for (entity_iterator_t p = begin; p != end; ++p, k++) {
+				IRIS_ASSERT(!valid(*p));
+				entities.push(*p);
+				entity_components[old_size + k] = iris_make_key_value((entity_t)*p, index);
+				set_index(*p, index);
+				index++;
+			}
+
+			push_components_batch(count, placeholder<components_t...>(), component_begins...);
+
+			// one-pass backward merge of the old sorted run and the incoming one
+			std::vector<iris_key_value_t<entity_t, index_t>> incoming(count);
+			for (size_t n = 0; n < count; n++) {
+				incoming[n] = entity_components[old_size + n];
+			}
+			ptrdiff_t a = (ptrdiff_t)old_size - 1;
+			ptrdiff_t b = (ptrdiff_t)count - 1;
+			ptrdiff_t w = (ptrdiff_t)(old_size + count) - 1;
+
+			while (b >= 0) {
+				if (a >= 0 && incoming[(size_t)b].first < entity_components[(size_t)a].first) {
+					entity_components[(size_t)w--] = entity_components[(size_t)a--];
+				} else {
+					entity_components[(size_t)w--] = incoming[(size_t)b--];
+				}
+			}
+
+			modify_version++;
+		}
+
 		void compress() noexcept {
 			auto guard = write_fence();
 
@@ -152,6 +433,64 @@ namespace iris {
 			}
 
 			entity_components.resize(j);
+			modify_version++;
+		}
+
+		// incrementally restore component storage to entity order, undoing the
+		// churn of remove()'s swap-with-last. performs at most budget_entities
+		// element swaps per call, so it can run from a maintenance warp each frame.
+		// any insert/remove between calls restarts the pass. returns true once
+		// storage is fully sorted.
+		bool compact(size_t budget_entities) {
+			auto guard = write_fence();
+
+			if (compact_version != modify_version) {
+				// storage changed since last call, restart the pass
+				compact_version = modify_version;
+				compact_position = 0;
+				compact_rank = 0;
+			}
+
+			size_t base_index = entities.begin_index();
+			while (budget_entities != 0 && compact_position < entity_components.size()) {
+				auto& entry = entity_components[compact_position];
+				// skip removed entries and stale ones pointing beyond the live range
+				if (entry.second == ~(index_t)0 || (size_t)entry.second >= entities.end_index()) {
+					compact_position++;
+					continue;
+				}
+
+				index_t target = iris_verify_cast<index_t>(base_index + compact_rank);
+				if (entry.second != target) {
+					// swap storage slots and patch the entity owning the target slot
+					entity_t other_entity = entities.get(target);
+					auto it = iris_binary_find(entity_components.begin(), entity_components.end(), other_entity);
+					IRIS_ASSERT(it != entity_components.end() && it->second == target);
+
+					swap_components(entry.second, target, placeholder<components_t...>());
+					entities.get(target) = entity_components[compact_position].first;
+					entities.get(entry.second) = other_entity;
+
+					it->second = entry.second;
+					set_index(other_entity, entry.second);
+					set_index(entry.first, target);
+					entry.second = target;
+					compact_moved = true;
+					budget_entities--;
+				}
+
+				compact_position++;
+				compact_rank++;
+			}
+
+			if (compact_moved) {
+				// swaps relocated components, cached views must refresh.
+				// follow our own bump so the running pass is not restarted.
+				compact_version = ++modify_version;
+				compact_moved = false;
+			}
+
+			return compact_position >= entity_components.size();
 		}
 
 		size_t size() const noexcept {
@@ -164,13 +503,20 @@ namespace iris {
 		component_t& get(entity_t entity) noexcept {
 			auto guard = read_fence();
 			IRIS_ASSERT(valid(entity));
-			return std::get<fetch_index<component_t>::value>(components).get(iris_binary_find(entity_components.begin(), entity_components.end(), entity)->second);
+			return std::get<fetch_index<component_t>::value>(components).get(find_index(entity));
 		}
 
 		template <typename... for_components_t, typename operation_t>
 		bool filter(entity_t entity, operation_t&& op) {
-			entity_t arr[1] = { entity };
-			return filter<for_components_t...>(&arr[0], &arr[0] + 1, std::forward<operation_t>(op)) == (&arr[0] + 1);
+			auto guard = read_fence();
+
+			index_t index = find_index(entity);
+			if (index == ~(index_t)0) {
+				return false;
+			}
+
+			op(std::get<fetch_index<for_components_t>::value>(components).get(index)...);
+			return true;
 		}
 
 		template <typename... for_components_t, typename iterator_t, typename operation_t>
@@ -196,7 +542,7 @@ namespace iris {
 			auto guard = read_fence();
 
 			IRIS_ASSERT(valid(entity));
-			return std::get<fetch_index<component_t>::value>(components).get(iris_binary_find(entity_components.begin(), entity_components.end(), entity)->second);
+			return std::get<fetch_index<component_t>::value>(components).get(find_index(entity));
 		}
 
 		// entity-based component removal
@@ -230,11 +576,16 @@ namespace iris {
 					ip->second = ~(index_t)0;
 					move_components(index, placeholder<components_t...>());
 
-					*(entities.begin() + (it - entity_components.begin())) = top_entity; // update recorded entity list
+					entities.get(index) = top_entity; // update recorded entity list at the reused slot
+					set_index(top_entity, index);
+					set_index(entity, ~(index_t)0);
+				} else {
+					set_index(entity, ~(index_t)0);
 				}
 
 				pop_components(placeholder<components_t...>());
 				entities.pop();
+				modify_version++;
 				++begin;
 			}
 
@@ -246,6 +597,8 @@ namespace iris {
 			clear_components(placeholder<components_t...>());
 			entities.clear();
 			entity_components.clear();
+			entity_index_shards.clear();
+			modify_version++;
 		}
 
 		// iterate components
@@ -258,8 +611,8 @@ namespace iris {
 			const auto iterators_end = std::make_tuple(component<for_components_t>().end()...);
 
 			while (std::get<0>(iterators_begin) != std::get<0>(iterators_end)) {
+				// do_operation steps all iterators by one
 				do_operation(iterators_begin, op, iris_make_sequence<std::tuple_size<decltype(iterators_begin)>::value>());
-				step_iterators(iterators_begin, 1);
 			}
 		}
 
@@ -281,8 +634,71 @@ namespace iris {
 			}
 		}
 
+		// iterate components in parallel: the range is split into batches of
+		// batch_count elements queued onto the given async worker (e.g. an
+		// iris_async_worker_t), and the calling thread helps polling until all
+		// batches completed. op must be safe to run concurrently on disjoint
+		// element ranges, and the system must not be mutated meanwhile.
+		template <typename... for_components_t, typename async_worker_t, typename operation_t>
+		void iterate_parallel(async_worker_t& worker, size_t batch_count, operation_t&& op) {
+			IRIS_PROFILE_SCOPE(__FUNCTION__);
+
+			auto guard = read_fence();
+			auto iterators_begin = std::make_tuple(component<for_components_t>().begin()...);
+			const auto iterators_end = std::make_tuple(component<for_components_t>().end()...);
+
+			size_t total = iris_verify_cast<size_t>(std::get<0>(iterators_end) - std::get<0>(iterators_begin));
+			if (total == 0) {
+				return;
+			}
+
+			batch_count = std::max(batch_count, (size_t)1);
+			std::atomic<size_t> remaining;
+			remaining.store((total + batch_count - 1) / batch_count, std::memory_order_relaxed);
+
+			for (size_t i = 0; i < total; i += batch_count) {
+				size_t count = std::min(i + batch_count, total) - i;
+				auto iterators_chunk = iterators_begin;
+				worker.queue([iterators_chunk, count, &op, &remaining]() mutable {
+					for (size_t n = 0; n < count; n++) {
+						// do_operation steps all iterators by one
+						do_operation(iterators_chunk, op, iris_make_sequence<std::tuple_size<decltype(iterators_chunk)>::value>());
+					}
+
+					remaining.fetch_sub(1, std::memory_order_release);
+				});
+
+				step_iterators(iterators_begin, count);
+			}
+
+			// help executing remaining batches instead of blocking
+			while (remaining.load(std::memory_order_acquire) != 0) {
+				if (worker.poll()) {
+					iris_thread_pause();
+				}
+			}
+		}
+
+		// batch size targeting a fixed per-call working-set budget: derived at
+		// compile time from the element sizes of the queried components (an
+		// 8-byte tag iterates in far larger batches than 512-byte skeletal
+		// state), overridable at runtime via the budget argument so hand-tuned
+		// constants stop going stale when components change size.
+		static constexpr size_t default_batch_budget = size_t(1) << 17; // ~half a typical L2
+
+		template <typename... for_components_t>
+		static constexpr size_t auto_batch_count(size_t working_set_budget = default_batch_budget) {
+			return working_set_budget / component_sizes(placeholder<for_components_t...>()) == 0 ? 1 : working_set_budget / component_sizes(placeholder<for_components_t...>());
+		}
+
+		// iterate_batch with the automatically derived batch size
+		template <typename... for_components_t, typename operation_t>
+		void iterate_batch_auto(operation_t&& op, size_t working_set_budget = default_batch_budget) {
+			iterate_batch<for_components_t...>(auto_batch_count<for_components_t...>(working_set_budget), std::forward<operation_t>(op));
+		}
+
 		template <typename component_t>
-		typename std::enable_if<!std::is_same<component_t, entity_t>::value, iris_queue_list_t<component_t, allocator_t>&>::type component() noexcept {
+		typename std::enable_if<!std::is_same<component_t, entity_t>::value, typename component_storage<component_t>::type&>::type component() noexcept {
 			auto guard = read_fence();
 			return std::get<fetch_index<component_t>::value>(components);
 		}
@@ -294,7 +710,7 @@ namespace iris {
 		}
 
 		template <typename component_t>
-		typename std::enable_if<!std::is_same<component_t, entity_t>::value, const iris_queue_list_t<component_t, allocator_t>&>::type component() const noexcept {
+		typename std::enable_if<!std::is_same<component_t, entity_t>::value, const typename component_storage<component_t>::type&>::type component() const noexcept {
 			auto guard = read_fence();
 			return std::get<fetch_index<component_t>::value>(components);
 		}
@@ -310,7 +726,19 @@ namespace iris {
 			return fetch_index<component_t>::value < sizeof...(components_t);
 		}
 
-		using entity_components_t = std::vector<iris_key_value_t<entity_t, index_t>, vector_allocator_t<iris_key_value_t<entity_t, index_t>>>;
+		// select inline small-vector storage when the vector allocator carries
+		// an inline_capacity tag, see iris_inline_storage_allocator_t
+		template <typename alloc_t, typename = void>
+		struct entity_components_storage {
+			using type = std::vector<iris_key_value_t<entity_t, index_t>, vector_allocator_t<iris_key_value_t<entity_t, index_t>>>;
+		};
+
+		template <typename alloc_t>
+		struct entity_components_storage<alloc_t, iris_void_t<decltype(alloc_t::inline_capacity)>> {
+			using type = iris_small_vector_t<iris_key_value_t<entity_t, index_t>, alloc_t::inline_capacity>;
+		};
+
+		using entity_components_t = typename entity_components_storage<vector_allocator_t<entity_t>>::type;
 		entity_components_t& get_entity_components() noexcept {
 			return entity_components;
 		}
@@ -337,7 +765,7 @@ namespace iris {
 		template <typename first_t, typename... elements_t>
 		void move_components(index_t index, placeholder<first_t, elements_t...>) noexcept {
 			auto& comp = std::get<sizeof...(elements_t)>(components);
-			auto& top = comp.top();
+			auto&& top = comp.top();
 			comp.get(index) = std::move(top);
 
 			move_components(index, placeholder<elements_t...>());
@@ -345,6 +773,69 @@ namespace iris {
 
 		void move_components(index_t& index, placeholder<>) noexcept {}
 
+		template <typename first_t, typename... elements_t>
+		static void check_snapshot_types(placeholder<first_t, elements_t...>) noexcept {
+			static_assert(std::is_trivially_copy_constructible<first_t>::value && std::is_trivially_destructible<first_t>::value, "components must be trivially copyable to snapshot!");
+			check_snapshot_types(placeholder<elements_t...>());
+		}
+
+		static void check_snapshot_types(placeholder<>) noexcept {}
+
+		template <typename first_t, typename... elements_t>
+		static constexpr size_t component_sizes(placeholder<first_t, elements_t...>) noexcept {
+			return sizeof(first_t) + component_sizes(placeholder<elements_t...>());
+		}
+
+		static constexpr size_t component_sizes(placeholder<>) noexcept {
+			return 0;
+		}
+
+		template <typename operation_t, typename first_t, typename... elements_t>
+		void save_components(operation_t&& emit, placeholder<first_t, elements_t...>) const {
+			std::get<sizeof...(components_t) - sizeof...(elements_t) - 1>(components).for_each([&emit](const first_t* data, size_t count) {
+				emit(reinterpret_cast<const uint8_t*>(data), count * sizeof(first_t));
+			});
+
+			save_components(emit, placeholder<elements_t...>());
+		}
+
+		template <typename operation_t>
+		void save_components(operation_t&&, placeholder<>) const noexcept {}
+
+		template <typename first_t, typename... elements_t>
+		void load_components(const uint8_t* data, size_t& offset, size_t entity_count, placeholder<first_t, elements_t...>) {
+			std::get<sizeof...(components_t) - sizeof...(elements_t) - 1>(components).push_n(reinterpret_cast<const first_t*>(data + offset), entity_count);
+			offset += entity_count * sizeof(first_t);
+
+			load_components(data, offset, entity_count, placeholder<elements_t...>());
+		}
+
+		void load_components(const uint8_t*, size_t&, size_t, placeholder<>) noexcept {}
+
+		template <typename first_component_t, typename... remaining_components_t, typename first_iterator_t, typename... remaining_iterators_t>
+		void push_components_batch(size_t count, placeholder<first_component_t, remaining_components_t...>, first_iterator_t it, remaining_iterators_t... remaining) {
+			auto& list = std::get<sizeof...(components_t) - sizeof...(remaining_components_t) - 1>(components);
+			for (size_t n = 0; n < count; n++) {
+				list.push(*it++);
+			}
+
+			push_components_batch(count, placeholder<remaining_components_t...>(), remaining...);
+		}
+
+		void push_components_batch(size_t, placeholder<>) noexcept {}
+
+		template <typename first_t, typename... elements_t>
+		void swap_components(index_t a, index_t b, placeholder<first_t, elements_t...>) {
+			auto& comp = std::get<sizeof...(elements_t)>(components);
+			typename std::decay<decltype(comp)>::type::element_t tmp(std::move(comp.get(a)));
+			comp.get(a) = std::move(comp.get(b));
+			comp.get(b) = std::move(tmp);
+
+			swap_components(a, b, placeholder<elements_t...>());
+		}
+
+		void swap_components(index_t a, index_t b, placeholder<>) noexcept {}
+
 		template <typename first_t, typename... elements_t>
 		void pop_components(placeholder<first_t, elements_t...>) noexcept {
 			std::get<sizeof...(elements_t)>(components).pop();
@@ -361,10 +852,322 @@ namespace iris {
 
 		void clear_components(placeholder<>) noexcept {}
 
+	public:
+		size_t get_modify_version() const noexcept {
+			return modify_version;
+		}
+
+		// versioned binary snapshot of the whole system: entities, the entity
+		// index and every component list are emitted as contiguous per-node runs
+		// (one memcpy per node for trivially copyable components), so saving is
+		// bandwidth-bound. emit(data, size) is invoked per run and may queue
+		// chunked async writes through a warp or iris_file_t.
+		static constexpr uint32_t snapshot_magic = 0x53595353u; // 'SSYS'
+		static constexpr uint32_t snapshot_version = 1;
+
+		struct snapshot_header_t {
+			uint32_t magic;
+			uint32_t version;
+			uint64_t component_count;
+			uint64_t entity_count;
+			uint64_t entity_component_count;
+		};
+
+		template <typename operation_t>
+		void save_snapshot(operation_t&& emit) const {
+			check_snapshot_types(placeholder<components_t...>());
+			auto guard = read_fence();
+
+			snapshot_header_t header;
+			header.magic = snapshot_magic;
+			header.version = snapshot_version;
+			header.component_count = sizeof...(components_t);
+			header.entity_count = entities.size();
+			header.entity_component_count = entity_components.size();
+			emit(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+
+			entities.for_each([&emit](const entity_t* data, size_t count) {
+				emit(reinterpret_cast<const uint8_t*>(data), count * sizeof(entity_t));
+			});
+
+			if (!entity_components.empty()) {
+				// rebase indices into the reloaded counter domain, which starts
+				// at zero again; stale entries are emitted as removed
+				std::vector<iris_key_value_t<entity_t, index_t>> rebased(entity_components.begin(), entity_components.end());
+				size_t base = entities.begin_index();
+				size_t end = entities.end_index();
+				for (size_t i = 0; i < rebased.size(); i++) {
+					index_t& index = rebased[i].second;
+					if (index == ~(index_t)0 || (size_t)index < base || (size_t)index >= end) {
+						index = ~(index_t)0;
+					} else {
+						index = iris_verify_cast<index_t>((size_t)index - base);
+					}
+				}
+
+				emit(reinterpret_cast<const uint8_t*>(&rebased[0]), rebased.size() * sizeof(rebased[0]));
+			}
+
+			save_components(emit, placeholder<components_t...>());
+		}
+
+		void save_snapshot(std::vector<uint8_t>& out) const {
+			save_snapshot([&out](const uint8_t* data, size_t size) {
+				out.insert(out.end(), data, data + size);
+			});
+		}
+
+		// reconstruct the system from a snapshot without per-entity inserts:
+		// component node chains are rebuilt by bulk push_n per run
+		bool load_snapshot(const uint8_t* data, size_t size) {
+			check_snapshot_types(placeholder<components_t...>());
+			auto guard = write_fence();
+
+			snapshot_header_t header;
+			if (size < sizeof(header)) {
+				return false;
+			}
+
+			std::memcpy(&header, data, sizeof(header));
+			if (header.magic != snapshot_magic || header.version != snapshot_version || header.component_count != sizeof...(components_t)) {
+				return false;
+			}
+
+			// validate each count by division against the remaining bytes, so
+			// hostile counts cannot wrap the arithmetic and drive push_n/memcpy
+			// past the input buffer
+			size_t remaining = size - sizeof(header);
+			if (header.entity_count > remaining / sizeof(entity_t)) {
+				return false;
+			}
+
+			size_t entity_count = iris_verify_cast<size_t>(header.entity_count);
+			remaining -= entity_count * sizeof(entity_t);
+			if (header.entity_component_count > remaining / sizeof(iris_key_value_t<entity_t, index_t>)) {
+				return false;
+			}
+
+			size_t entry_count = iris_verify_cast<size_t>(header.entity_component_count);
+			remaining -= entry_count * sizeof(iris_key_value_t<entity_t, index_t>);
+			if (component_sizes(placeholder<components_t...>()) != 0 && entity_count > remaining / component_sizes(placeholder<components_t...>())) {
+				return false;
+			}
+
+			clear();
+			size_t offset = sizeof(header);
+
+			entities.push_n(reinterpret_cast<const entity_t*>(data + offset), entity_count);
+			offset += entity_count * sizeof(entity_t);
+
+			entity_components.resize(entry_count);
+			if (entry_count != 0) {
+				std::memcpy(&entity_components[0], data + offset, entry_count * sizeof(entity_components[0]));
+			}
+
+			offset += entry_count * sizeof(iris_key_value_t<entity_t, index_t>);
+			load_components(data, offset, entity_count, placeholder<components_t...>());
+
+			// rebuild the sharded index
+			for (size_t i = 0; i < entity_components.size(); i++) {
+				if (entity_components[i].second != ~(index_t)0) {
+					set_index(entity_components[i].first, entity_components[i].second);
+				}
+			}
+
+			modify_version++;
+			return true;
+		}
+
+		// sharded direct-mapped entity index: each shard covers a fixed span of
+		// entity values and stores the component index per slot, so single-entity
+		// lookups are O(1) instead of binary searches over entity_components.
+		// the sorted entity_components vector stays authoritative for ordered scans.
+		static constexpr size_t index_shard_size = 256;
+		using index_shard_t = std::vector<index_t, vector_allocator_t<index_t>>;
+
+		index_t find_index(entity_t entity) const noexcept {
+			static_assert(std::is_integral<entity_t>::value, "entity_t must be integral for sharded indexing!");
+			size_t shard = (size_t)entity / index_shard_size;
+			if (shard >= entity_index_shards.size() || entity_index_shards[shard].empty()) {
+				return ~(index_t)0;
+			}
+
+			return entity_index_shards[shard][(size_t)entity % index_shard_size];
+		}
+
+		void set_index(entity_t entity, index_t index) {
+			size_t shard = (size_t)entity / index_shard_size;
+			if (shard >= entity_index_shards.size()) {
+				entity_index_shards.resize(shard + 1);
+			}
+
+			index_shard_t& slots = entity_index_shards[shard];
+			if (slots.empty()) {
+				slots.assign(index_shard_size, ~(index_t)0);
+			}
+
+			slots[(size_t)entity % index_shard_size] = index;
+		}
+
 	protected:
-		std::tuple<iris_queue_list_t<components_t, allocator_t>...> components;
+		std::tuple<typename component_storage<components_t>::type...> components;
 		entity_components_t entity_components;
 		iris_queue_list_t<entity_t, allocator_t> entities;
+		std::vector<index_shard_t, vector_allocator_t<index_shard_t>> entity_index_shards;
+		size_t modify_version = 0; // bumped on structural changes, invalidates compact cursor
+		size_t compact_version = 0; // modify_version as of the running compact pass
+		size_t compact_position = 0; // current position of compact in entity_components
+		size_t compact_rank = 0; // rank of current position among live entries
+		bool compact_moved = false; // whether the running compact pass relocated components
+	};
+
+	// persistent cached view over a component set of one system: subscribed
+	// entities resolve to component iterators once, and repeated for_each calls
+	// over a stable system cost zero lookups. any mutation of the system
+	// (tracked via its modify version) lazily refreshes the cache at the next
+	// iteration; entities that disappeared are dropped from the view.
+	template <typename system_t, typename... for_components_t>
+	struct iris_system_view_t {
+		using entity_t = typename system_t::index_t;
+
+		iris_system_view_t(system_t& sys) : system(sys), cached_version(~(size_t)0) {}
+
+		void subscribe(entity_t entity) {
+			iris_binary_insert(subscribed, entity);
+			cached_version = ~(size_t)0; // force refresh
+		}
+
+		template <typename iterator_t>
+		void subscribe(iterator_t begin, iterator_t end) {
+			while (begin != end) {
+				iris_binary_insert(subscribed, *begin++);
+			}
+
+			cached_version = ~(size_t)0;
+		}
+
+		void unsubscribe(entity_t entity) {
+			iris_binary_erase(subscribed, entity);
+			cached_version = ~(size_t)0;
+		}
+
+		size_t size() {
+			refresh();
+			return cached_iterators.size();
+		}
+
+		// iterate the cached component references, op(components&...)
+		template <typename operation_t>
+		void for_each(operation_t&& op) {
+			refresh();
+
+			for (size_t i = 0; i < cached_iterators.size(); i++) {
+				invoke_one(op, cached_iterators[i], iris_make_sequence<sizeof...(for_components_t)>());
+			}
+		}
+
+	protected:
+		using iterators_t = std::tuple<decltype(std::declval<system_t>().template component<for_components_t>().begin())...>;
+
+		void refresh() {
+			if (cached_version == system.get_modify_version()) {
+				return;
+			}
+
+			cached_iterators.clear();
+			for (size_t i = 0; i < subscribed.size(); i++) {
+				entity_t index = system.find_index(subscribed[i]);
+				if (index != ~(entity_t)0) {
+					cached_iterators.emplace_back(make_iterators((size_t)index, iris_make_sequence<sizeof...(for_components_t)>()));
+				}
+			}
+
+			cached_version = system.get_modify_version();
+		}
+
+		// resolve the packed index once, then advance each component iterator to it
+		template <size_t... i>
+		iterators_t make_iterators(size_t index, iris_sequence<i...>) {
+			return iterators_t((system.template component<for_components_t>().begin() + (ptrdiff_t)(index - system.template component<for_components_t>().begin_index()))...);
+		}
+
+		template <typename operation_t, size_t... i>
+		static void invoke_one(operation_t& op, iterators_t& iterators, iris_sequence<i...>) {
+			op(*std::get<i>(iterators)...);
+		}
+
+	protected:
+		system_t& system;
+		size_t cached_version;
+		std::vector<entity_t> subscribed;
+		std::vector<iterators_t> cached_iterators;
+	};
+
+	// double-buffered read snapshot of one component type: flip() synchronizes
+	// an immutable shadow array with the live component list, copying only the
+	// node-sized pages that actually changed since the last flip. since
+	// component writes go through plain references and are untracked, changed
+	// pages are detected by comparison - the linear scan is cheap, the write
+	// traffic drops to the dirty pages. readers iterate the snapshot while the
+	// simulation writes the live state for the next tick; flip() itself must
+	// run in the gap between phases and is fenced like other system mutations.
+	template <typename system_t, typename component_t>
+	struct iris_component_snapshot_t : protected enable_read_write_fence_t<> {
+		static_assert(std::is_trivially_copy_constructible<component_t>::value && std::is_trivially_destructible<component_t>::value, "component_t must be trivially copyable to snapshot!");
+
+		iris_component_snapshot_t(system_t& sys) noexcept : system(sys) {}
+
+		// bring the shadow up to date with the live component state
+		void flip() {
+			auto guard = write_fence();
+
+			auto& list = system.template component<component_t>();
+			size_t count = list.size();
+			size_t previous = shadow.size();
+			shadow.resize(count);
+
+			static constexpr size_t page = std::decay<decltype(list)>::type::element_count;
+			auto it = list.begin();
+			size_t offset = 0;
+
+			while (offset < count) {
+				size_t chunk = std::min(page, count - offset);
+				auto start = it;
+
+				// probe the page, copy it only when something changed
+				bool dirty = offset + chunk > previous;
+				if (!dirty) {
+					for (size_t k = 0; k < chunk; k++) {
+						if (std::memcmp(&shadow[offset + k], &*it, sizeof(component_t)) != 0) {
+							dirty = true;
+							break;
+						}
+
+						++it;
+					}
+				}
+
+				if (dirty) {
+					it = start;
+					for (size_t k = 0; k < chunk; k++) {
+						std::memcpy(&shadow[offset + k], &*it, sizeof(component_t));
+						++it;
+					}
+				}
+
+				offset += chunk;
+			}
+		}
+
+		// immutable view for readers, stable until the next flip()
+		const std::vector<component_t>& get() const noexcept {
+			auto guard = read_fence();
+			return shadow;
+		}
+
+	protected:
+		system_t& system;
+		std::vector<component_t> shadow;
 	};
 
 	template <typename entity_t, template <typename...> class allocator_t = iris_default_block_allocator_t>
@@ -398,6 +1201,225 @@ namespace iris {
 		entity_t max_allocated_entity = 0;
 	};
 
+	// dense compile-time component ids: specialize iris_component_id_t<type>
+	// with a unique small index (or bind your component enum) and component
+	// sets collapse to static bitmasks, so cross-system compatibility checks
+	// become a single AND instead of per-component hash lookups. components
+	// without an id keep working through the runtime hash path.
+	template <typename type_t>
+	struct iris_component_id_t;
+
+	namespace impl {
+		template <typename type_t, typename = void>
+		struct has_component_id_t : std::false_type {};
+
+		template <typename type_t>
+		struct has_component_id_t<type_t, iris_void_t<decltype(iris_component_id_t<type_t>::value)>> : std::true_type {};
+
+		template <typename type_t, bool = has_component_id_t<type_t>::value>
+		struct component_mask_of_t {
+			static_assert(iris_component_id_t<type_t>::value < sizeof(size_t) * 8, "component id out of mask range!");
+			static constexpr size_t value = size_t(1) << iris_component_id_t<type_t>::value;
+			static constexpr bool valid = true;
+		};
+
+		template <typename type_t>
+		struct component_mask_of_t<type_t, false> {
+			static constexpr size_t value = 0;
+			static constexpr bool valid = false;
+		};
+
+		template <typename... types_t>
+		struct component_set_mask_t;
+
+		template <>
+		struct component_set_mask_t<> {
+			static constexpr size_t value = 0;
+			static constexpr bool valid = true;
+		};
+
+		template <typename first_t, typename... types_t>
+		struct component_set_mask_t<first_t, types_t...> {
+			static constexpr size_t value = component_mask_of_t<first_t>::value | component_set_mask_t<types_t...>::value;
+			static constexpr bool valid = component_mask_of_t<first_t>::valid && component_set_mask_t<types_t...>::valid;
+		};
+	}
+
+	// declared access modes for the conflict-aware system scheduler
+	template <typename type_t>
+	struct iris_read_t {
+		using component_t = type_t;
+		static constexpr bool is_write = false;
+	};
+
+	template <typename type_t>
+	struct iris_write_t {
+		using component_t = type_t;
+		static constexpr bool is_write = true;
+	};
+
+	// conflict-aware parallel scheduling of system passes: each pass declares
+	// the components it reads and writes via iris_read_t/iris_write_t template
+	// arguments (resolved at compile time to stable type hashes), two passes
+	// conflict when one writes a component the other touches. attach() derives
+	// the dependency edges against all earlier passes and dispatch() hands the
+	// resulting graph to an iris_dispatcher_t, so non-conflicting systems run
+	// concurrently without hand-assigned ordering.
+	template <typename dispatcher_t>
+	struct iris_system_scheduler_t {
+		using routine_t = typename dispatcher_t::routine_t;
+		using warp_t = typename dispatcher_t::warp_t;
+
+		iris_system_scheduler_t(dispatcher_t& disp) : dispatcher(disp) {}
+
+		// declare a system pass with its access modes, e.g.
+		// attach<iris_write_t<transform_t>, iris_read_t<velocity_t>>(warp, func)
+		template <typename... accesses_t, typename func_t>
+		routine_t* attach(warp_t* warp, func_t&& func, size_t priority = 0) {
+			task_info_t info;
+			info.routine = dispatcher.allocate(warp, std::forward<func_t>(func), priority);
+			fill_accesses(info.accesses, placeholder<accesses_t...>());
+
+			// conflicting passes execute in attach order
+			for (size_t i = 0; i < tasks.size(); i++) {
+				if (conflicts(tasks[i].accesses, info.accesses)) {
+					dispatcher.order(tasks[i].routine, info.routine);
+				}
+			}
+
+			routine_t* routine = info.routine;
+			tasks.emplace_back(std::move(info));
+			return routine;
+		}
+
+		// dispatch all attached passes at once and reset for the next frame
+		void dispatch() {
+			for (size_t i = 0; i < tasks.size(); i++) {
+				dispatcher.dispatch(tasks[i].routine);
+			}
+
+			tasks.clear();
+		}
+
+		size_t size() const noexcept {
+			return tasks.size();
+		}
+
+	protected:
+		struct access_t {
+			size_t hash;
+			bool write;
+		};
+
+		struct task_info_t {
+			routine_t* routine;
+			std::vector<access_t> accesses;
+		};
+
+		template <typename type_t>
+		struct access_tag_t {};
+
+		template <typename type_t>
+		static size_t access_hash() noexcept {
+			return iris_static_instance_t<access_tag_t<type_t>>::get_unique_hash();
+		}
+
+		static bool conflicts(const std::vector<access_t>& lhs, const std::vector<access_t>& rhs) noexcept {
+			for (size_t i = 0; i < lhs.size(); i++) {
+				for (size_t k = 0; k < rhs.size(); k++) {
+					if (lhs[i].hash == rhs[k].hash && (lhs[i].write || rhs[k].write)) {
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+		template <typename first_t, typename... remaining_t>
+		static void fill_accesses(std::vector<access_t>& accesses, placeholder<first_t, remaining_t...>) {
+			access_t access;
+			access.hash = access_hash<typename first_t::component_t>();
+			access.write = first_t::is_write;
+			accesses.emplace_back(access);
+
+			fill_accesses(accesses, placeholder<remaining_t...>());
+		}
+
+		static void fill_accesses(std::vector<access_t>&, placeholder<>) noexcept {}
+
+	protected:
+		dispatcher_t& dispatcher;
+		std::vector<task_info_t> tasks;
+	};
+
+	// generational entity allocator: a handle composes a reusable index with a
+	// generation that is bumped on every free, so a stale handle can never
+	// alias the entity that recycled its index and validity becomes one array
+	// compare instead of a side-table probe per access. store get_index() of a
+	// handle in iris_system_t (keeping the index space dense) and gate accesses
+	// with is_valid(handle).
+	template <typename entity_t, size_t generation_bits = 8, template <typename...> class allocator_t = iris_default_block_allocator_t>
+	struct iris_generational_entity_allocator_t : protected enable_in_out_fence_t<> {
+		static constexpr size_t index_bits = sizeof(entity_t) * 8 - generation_bits;
+		static constexpr entity_t index_mask = (entity_t(1) << index_bits) - 1;
+		static constexpr entity_t generation_mask = (entity_t(1) << generation_bits) - 1;
+
+		static constexpr entity_t get_index(entity_t handle) noexcept {
+			return handle & index_mask;
+		}
+
+		static constexpr entity_t get_generation(entity_t handle) noexcept {
+			return (handle >> index_bits) & generation_mask;
+		}
+
+		entity_t allocate() {
+			auto guard = in_fence();
+
+			entity_t index;
+			if (!free_indices.empty()) {
+				index = free_indices.top();
+				free_indices.pop();
+			} else {
+				index = max_allocated_index++;
+				IRIS_ASSERT((size_t)index <= (size_t)index_mask);
+				generations.resize((size_t)index + 1, 0);
+			}
+
+			return index | (entity_t)(generations[(size_t)index] << index_bits);
+		}
+
+		// bump the generation so every outstanding copy of the handle goes stale
+		void free(entity_t handle) {
+			auto guard = out_fence();
+			IRIS_ASSERT(is_valid(handle));
+
+			entity_t index = get_index(handle);
+			generations[(size_t)index] = (generations[(size_t)index] + 1) & generation_mask;
+			free_indices.push(index);
+		}
+
+		// O(1) staleness check, replaces per-access side-table probes
+		bool is_valid(entity_t handle) const noexcept {
+			entity_t index = get_index(handle);
+			return (size_t)index < generations.size() && generations[(size_t)index] == get_generation(handle);
+		}
+
+		void reset() noexcept(noexcept(std::declval<iris_generational_entity_allocator_t>().free_indices.reset(0))) {
+			auto in_guard = in_fence();
+			auto out_guard = out_fence();
+
+			free_indices.reset(0);
+			generations.clear();
+			max_allocated_index = 0;
+		}
+
+	protected:
+		iris_queue_list_t<entity_t, allocator_t> free_indices;
+		std::vector<entity_t> generations; // current generation per index
+		entity_t max_allocated_index = 0;
+	};
+
 	template <typename entity_t, template <typename...> class allocator_t, template <typename...> class vector_allocator_t = std::allocator>
 	struct iris_systems_t : protected enable_read_write_fence_t<> {
 		template <typename type_t>
@@ -419,6 +1441,8 @@ namespace iris {
 			void (*clear)(void*) = nullptr;
 			std::vector<iris_key_value_t<entity_t, index_t>, vector_allocator_t<iris_key_value_t<entity_t, index_t>>>* entity_components = nullptr;
 			std::vector<iris_key_value_t<size_t, void*>> components;
+			size_t component_mask = 0; // dense id bitmask, see iris_component_id_t
+			bool component_mask_valid = false; // all components carry dense ids
 		};
 
 		template <typename system_t>
@@ -433,6 +1457,12 @@ namespace iris {
 			info.components = generate_info(info, sys, iris_make_sequence<std::tuple_size<typename system_t::components_tuple_t>::value>());
 			std::sort(info.components.begin(), info.components.end());
 
+			// dense-id bitmask over the component set (entity excluded), used to
+			// reject incompatible systems with one AND in iterate/filter
+			using mask_t = tuple_component_mask_t<typename system_t::components_tuple_t, 1, std::tuple_size<typename system_t::components_tuple_t>::value>;
+			info.component_mask = mask_t::value;
+			info.component_mask_valid = mask_t::valid;
+
 			system_infos.emplace_back(std::move(info));
 		}
 
@@ -455,6 +1485,55 @@ namespace iris {
 			}
 		}
 
+		// route an insert through the registry so the per-entity component
+		// mask stays current; forwards to system_t::insert
+		template <typename system_t, typename... elements_t>
+		bool insert(system_t& sys, entity_t entity, elements_t&&... elements) {
+			bool replaced = sys.insert(entity, std::forward<elements_t>(elements)...);
+
+			using mask_t = tuple_component_mask_t<typename system_t::components_tuple_t, 1, std::tuple_size<typename system_t::components_tuple_t>::value>;
+			if /* constexpr */ (mask_t::valid) {
+				set_entity_mask(entity, get_entity_mask(entity) | mask_t::value);
+			}
+
+			return replaced;
+		}
+
+		// per-entity component mask over all routed inserts, O(1)
+		size_t get_entity_mask(entity_t entity) const noexcept {
+			size_t shard = (size_t)entity / mask_shard_size;
+			if (shard >= entity_masks.size() || entity_masks[shard].empty()) {
+				return 0;
+			}
+
+			return entity_masks[shard][(size_t)entity % mask_shard_size];
+		}
+
+		// O(1) multi-component membership test via one mask AND, no per-system
+		// binary searches. requires dense ids for all queried components.
+		template <typename... for_components_t>
+		bool has(entity_t entity) const noexcept {
+			using query_mask_t = impl::component_set_mask_t<for_components_t...>;
+			static_assert(query_mask_t::valid, "all queried components need dense ids, see iris_component_id_t!");
+			return (get_entity_mask(entity) & query_mask_t::value) == query_mask_t::value;
+		}
+
+		// copy only the entities of [begin, end) whose mask covers the queried
+		// components, skipping non-matching entities without touching any
+		// per-system index
+		template <typename... for_components_t, typename iterator_t, typename output_iterator_t>
+		output_iterator_t select(iterator_t begin, iterator_t end, output_iterator_t output) const {
+			while (begin != end) {
+				if (has<for_components_t...>(*begin)) {
+					*output++ = *begin;
+				}
+
+				++begin;
+			}
+
+			return output;
+		}
+
 		size_t remove(entity_t entity) {
 			auto guard = write_fence();
 			size_t count = 0;
@@ -463,6 +1542,7 @@ namespace iris {
 				count += system_info.remove(system_info.address, entity) ? 1u : 0u;
 			}
 
+			set_entity_mask(entity, 0);
 			return count;
 		}
 
@@ -486,13 +1566,17 @@ namespace iris {
 
 			for (size_t i = 0; i < system_infos.size(); i++) {
 				auto& system_info = system_infos[i];
+				if (reject_by_mask<for_components_t...>(system_info)) {
+					continue;
+				}
+
 				auto iterators_begin = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 				auto iterators_end = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 
 				if (match_iterators<decltype(iterators_begin), 0, for_components_t...>(iterators_begin, iterators_end, system_info)) {
 					while (std::get<0>(iterators_begin) != std::get<0>(iterators_end)) {
+						// do_operation steps all iterators by one
 						do_operation(iterators_begin, op, iris_make_sequence<std::tuple_size<decltype(iterators_begin)>::value>());
-						step_iterators(iterators_begin, 1);
 					}
 				}
 			}
@@ -504,6 +1588,10 @@ namespace iris {
 			auto guard = read_fence();
 			for (size_t i = 0; i < system_infos.size(); i++) {
 				auto& system_info = system_infos[i];
+				if (reject_by_mask<for_components_t...>(system_info)) {
+					continue;
+				}
+
 				auto iterators_begin = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 				auto iterators_end = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 
@@ -530,6 +1618,10 @@ namespace iris {
 
 			for (size_t i = 0; i < system_infos.size(); i++) {
 				auto& system_info = system_infos[i];
+				if (reject_by_mask<for_components_t...>(system_info)) {
+					continue;
+				}
+
 				auto iterators_begin = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 				auto iterators_end = std::make_tuple(typename iris_queue_list_t<for_components_t, allocator_t>::iterator()...);
 
@@ -546,13 +1638,17 @@ namespace iris {
 							break;
 						}
 
-						if (last_index < ip->second) {
+						// component indices are unordered with respect to entity order,
+						// rewind to the beginning when moving backwards
+						if (ip->second < last_index) {
 							it = iterators_begin;
 							last_index = 0;
 						}
 
 						step_iterators(it, ip->second - last_index);
+						// do_operation steps all iterators by one
 						do_operation(it, op, iris_make_sequence<std::tuple_size<decltype(iterators_begin)>::value>());
+						last_index = ip->second + 1;
 						++p;
 					}
 				}
@@ -561,6 +1657,56 @@ namespace iris {
 
 
 	protected:
+		static constexpr size_t mask_shard_size = 256;
+
+		void set_entity_mask(entity_t entity, size_t mask) {
+			size_t shard = (size_t)entity / mask_shard_size;
+			if (shard >= entity_masks.size()) {
+				if (mask == 0) {
+					return; // nothing recorded, nothing to clear
+				}
+
+				entity_masks.resize(shard + 1);
+			}
+
+			std::vector<size_t>& slots = entity_masks[shard];
+			if (slots.empty()) {
+				if (mask == 0) {
+					return;
+				}
+
+				slots.assign(mask_shard_size, 0);
+			}
+
+			slots[(size_t)entity % mask_shard_size] = mask;
+		}
+
+		template <typename tuple_t, size_t index, size_t count>
+		struct tuple_component_mask_t {
+			using element_t = typename std::tuple_element<index, tuple_t>::type;
+			using next_t = tuple_component_mask_t<tuple_t, index + 1, count>;
+			static constexpr size_t value = impl::component_mask_of_t<element_t>::value | next_t::value;
+			static constexpr bool valid = impl::has_component_id_t<element_t>::value && next_t::valid;
+		};
+
+		template <typename tuple_t, size_t count>
+		struct tuple_component_mask_t<tuple_t, count, count> {
+			static constexpr size_t value = 0;
+			static constexpr bool valid = true;
+		};
+
+		// one-AND compatibility pre-check: only applicable when both the query
+		// and the system carry dense ids for every component involved
+		template <typename... for_components_t>
+		static bool reject_by_mask(const system_info_t& system_info) noexcept {
+			using query_mask_t = impl::component_set_mask_t<for_components_t...>;
+			if /* constexpr */ (query_mask_t::valid) {
+				return system_info.component_mask_valid && (system_info.component_mask & query_mask_t::value) != query_mask_t::value;
+			}
+
+			return false;
+		}
+
 		template <typename system_t>
 		static bool remove_handler(void* address, entity_t entity) {
 			return reinterpret_cast<system_t*>(address)->remove(entity);
@@ -603,5 +1749,6 @@ namespace iris {
 
 	protected:
 		std::vector<system_info_t, vector_allocator_t<system_info_t>> system_infos;
+		std::vector<std::vector<size_t>> entity_masks; // sharded per-entity component masks
 	};
 }
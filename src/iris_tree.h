@@ -86,6 +86,36 @@ namespace iris {
 			get(value, index) = std::forward<value_t>(save);
 		}
 
+		// branch-free full overlap test of two ranges
+		static bool overlap(const element_t& lhs, const element_t& rhs) noexcept {
+			bool result = true;
+			for (index_t i = 0; i < size / 2; i++) {
+				result &= !(get(rhs, i + size / 2) < get(lhs, i)) & !(get(lhs, i + size / 2) < get(rhs, i));
+			}
+
+			return result;
+		}
+
+		// test one query against a contiguous run of keys at once, writing one
+		// flag per key and returning the hit count. the inner loops are plain
+		// dependency-free scalar arithmetic over adjacent keys, which the
+		// autovectorizer turns into simd lanes on packed layouts (see
+		// iris_tree_pool_t::for_each_overlap).
+		static size_t overlap_batch(const element_t& query, const element_t* keys, size_t count, bool* results) noexcept {
+			size_t hit_count = 0;
+			for (size_t k = 0; k < count; k++) {
+				bool result = true;
+				for (index_t i = 0; i < size / 2; i++) {
+					result &= !(get(keys[k], i + size / 2) < get(query, i)) & !(get(query, i + size / 2) < get(keys[k], i));
+				}
+
+				results[k] = result;
+				hit_count += result ? 1u : 0u;
+			}
+
+			return hit_count;
+		}
+
 		static constexpr element_t bound(const element_t& lhs) {
 			return lhs;
 		}
@@ -267,6 +297,60 @@ namespace iris {
 			return const_cast<iris_tree_t*>(this)->template query<right_skew>(std::forward<query_key_t>(target_key), std::forward<queryer_t>(queryer), std::forward<culler_t>(culler));
 		}
 
+		// batched query: the keys of [begin, end) are sorted by their morton code
+		// within their merged bound first, so consecutive descents revisit mostly
+		// the same hot subtrees instead of cold-missing from the root 200k times.
+		// queryer is invoked as queryer(key, node) and returns false to stop.
+		template <bool right_skew, typename key_iterator_t, typename queryer_t>
+		bool query_batch(key_iterator_t begin, key_iterator_t end, queryer_t&& queryer) const {
+			if (begin == end) {
+				return true;
+			}
+
+			std::vector<std::pair<size_t, key_iterator_t>> order = sort_query_keys(begin, end);
+			for (size_t i = 0; i < order.size(); i++) {
+				key_iterator_t it = order[i].second;
+				if (!query<right_skew>(*it, [&queryer, it](const iris_tree_t& node) { return queryer(*it, node); })) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// parallel batched query: sorted keys are chunked into tasks on the given
+		// async worker while the caller helps polling. the tree must not be
+		// mutated meanwhile and queryer must be safe to call concurrently.
+		template <bool right_skew, typename key_iterator_t, typename queryer_t, typename async_worker_t>
+		void query_batch(key_iterator_t begin, key_iterator_t end, queryer_t&& queryer, async_worker_t& worker, size_t batch_count = 64) const {
+			if (begin == end) {
+				return;
+			}
+
+			std::vector<std::pair<size_t, key_iterator_t>> order = sort_query_keys(begin, end);
+			batch_count = std::max(batch_count, (size_t)1);
+
+			std::atomic<size_t> remaining;
+			remaining.store((order.size() + batch_count - 1) / batch_count, std::memory_order_relaxed);
+
+			for (size_t i = 0; i < order.size(); i += batch_count) {
+				size_t count = std::min(i + batch_count, order.size()) - i;
+				const std::pair<size_t, key_iterator_t>* chunk = &order[i];
+				worker.queue([this, chunk, count, &queryer, &remaining]() {
+					for (size_t n = 0; n < count; n++) {
+						key_iterator_t it = chunk[n].second;
+						query<right_skew>(*it, [&queryer, it](const iris_tree_t& node) { return queryer(*it, node); });
+					}
+
+					remaining.fetch_sub(1, std::memory_order_release);
+				});
+			}
+
+			while (remaining.load(std::memory_order_acquire) != 0) {
+				worker.poll();
+			}
+		}
+
 		const key_t& get_key() const noexcept {
 			return key;
 		}
@@ -298,6 +382,60 @@ namespace iris {
 			iris_tree_t* tree;
 		};
 
+		// construct a balanced kd-tree from a range of detached node pointers by
+		// recursive median partitioning, returns the new root. the range is
+		// reordered in place.
+		template <typename iterator_t>
+		static iris_tree_t* build_bulk(iterator_t begin, iterator_t end, index_t index = 0) {
+			return build_bulk_range(begin, end, index, nullptr);
+		}
+
+		// parallel bulk build: median partitioning makes both halves fully
+		// independent, so subtree builds above the threshold are fanned out as
+		// tasks on the given async worker while the caller helps polling.
+		template <typename iterator_t, typename async_worker_t>
+		static iris_tree_t* build_bulk(iterator_t begin, iterator_t end, async_worker_t& worker, size_t parallel_threshold = 4096) {
+			if (begin >= end) {
+				return nullptr;
+			}
+
+			std::atomic<size_t> pending;
+			pending.store(1, std::memory_order_relaxed);
+
+			iris_tree_t* root = nullptr;
+			build_bulk_task(begin, end, (index_t)0, nullptr, &root, worker, pending, std::max(parallel_threshold, (size_t)1));
+			pending.fetch_sub(1, std::memory_order_release);
+
+			while (pending.load(std::memory_order_acquire) != 0) {
+				worker.poll();
+			}
+
+			return root;
+		}
+
+		// rebuild the whole tree in parallel over the given async worker, the
+		// counterpart of the serial optimize() for large trees
+		template <typename async_worker_t>
+		iris_tree_t* optimize(async_worker_t& worker, size_t parallel_threshold = 4096) {
+			// collect all nodes over the tree
+			std::vector<iris_tree_t*> all_nodes;
+			all_nodes.emplace_back(this);
+			size_t n = 0;
+
+			while (n < all_nodes.size()) {
+				iris_tree_t* tree = all_nodes[n++];
+				if (tree->left_node != nullptr) {
+					all_nodes.emplace_back(tree->left_node);
+				}
+
+				if (tree->right_node != nullptr) {
+					all_nodes.emplace_back(tree->right_node);
+				}
+			}
+
+			return build_bulk(all_nodes.begin(), all_nodes.end(), worker, parallel_threshold);
+		}
+
 		iris_tree_t* optimize() {
 			// collect all nodes over the tree
 			std::vector<tree_code_t> all_nodes;
@@ -338,10 +476,95 @@ namespace iris {
 		}
 
 	protected:
+		template <typename, typename>
+		friend struct iris_tree_pool_t;
+
 		void set_parent(iris_tree_t* t) noexcept {
 			parent_node = t;
 		}
 
+		// order query keys by morton code within their merged bound
+		template <typename key_iterator_t>
+		static std::vector<std::pair<size_t, key_iterator_t>> sort_query_keys(key_iterator_t begin, key_iterator_t end) {
+			auto box = meta::bound(*begin);
+			for (key_iterator_t it = begin; ++it != end;) {
+				meta::merge(box, *it);
+			}
+
+			std::vector<std::pair<size_t, key_iterator_t>> order;
+			for (key_iterator_t it = begin; it != end; ++it) {
+				order.emplace_back(meta::encode(box, *it), it);
+			}
+
+			std::sort(order.begin(), order.end(), [](const std::pair<size_t, key_iterator_t>& lhs, const std::pair<size_t, key_iterator_t>& rhs) { return lhs.first < rhs.first; });
+			return order;
+		}
+
+		struct bulk_compare_t {
+			explicit bulk_compare_t(index_t i) noexcept : index(i) {}
+			bool operator () (const iris_tree_t* lhs, const iris_tree_t* rhs) const noexcept {
+				return meta::compare(rhs->key, lhs->key, index);
+			}
+
+			index_t index;
+		};
+
+		// serial median-partitioned build, links children structurally so no
+		// comparisons against the rest of the tree are needed
+		template <typename iterator_t>
+		static iris_tree_t* build_bulk_range(iterator_t begin, iterator_t end, index_t index, iris_tree_t* parent) {
+			if (begin >= end) {
+				return nullptr;
+			}
+
+			iterator_t mid = begin + (end - begin) / 2;
+			std::nth_element(begin, mid, end, bulk_compare_t(index));
+
+			iris_tree_t* node = *mid;
+			node->key_index = index;
+			node->parent_node = parent;
+
+			index_t next = meta::next_index(index);
+			node->left_node = build_bulk_range(begin, mid, next, node);
+			node->right_node = build_bulk_range(mid + 1, end, next, node);
+			return node;
+		}
+
+		// parallel variant: the right half above the threshold is queued as a
+		// task, the left half continues on this thread. children write disjoint
+		// link fields, the pending counter publishes the result to the caller.
+		template <typename iterator_t, typename async_worker_t>
+		static void build_bulk_task(iterator_t begin, iterator_t end, index_t index, iris_tree_t* parent, iris_tree_t** slot, async_worker_t& worker, std::atomic<size_t>& pending, size_t parallel_threshold) {
+			while (begin < end) {
+				if (iris_verify_cast<size_t>(end - begin) <= parallel_threshold) {
+					*slot = build_bulk_range(begin, end, index, parent);
+					return;
+				}
+
+				iterator_t mid = begin + (end - begin) / 2;
+				std::nth_element(begin, mid, end, bulk_compare_t(index));
+
+				iris_tree_t* node = *mid;
+				node->key_index = index;
+				node->parent_node = parent;
+				node->left_node = nullptr;
+				node->right_node = nullptr;
+				*slot = node;
+
+				index = meta::next_index(index);
+				pending.fetch_add(1, std::memory_order_acquire);
+				worker.queue([mid, end, index, node, &worker, &pending, parallel_threshold]() {
+					build_bulk_task(mid + 1, end, index, node, &node->right_node, worker, pending, parallel_threshold);
+					pending.fetch_sub(1, std::memory_order_release);
+				});
+
+				// continue with the left half on this thread
+				parent = node;
+				slot = &node->left_node;
+				end = mid;
+			}
+		}
+
 		void build(iris_tree_t* root, tree_code_t* begin, tree_code_t* end, index_t index) {
 			if (begin < end) {
 				tree_code_t* mid = begin + (end - begin) / 2;
@@ -458,5 +681,447 @@ namespace iris {
 			} links;
 		};
 	};
+
+	// frozen immutable snapshot of an iris_tree_t: freeze() serializes the tree
+	// (ideally optimize()d first, the bfs layout is preserved) into a flat,
+	// position-independent blob of index-linked nodes. the blob can be written
+	// to disk, memory-mapped back and queried read-only through this view type
+	// without any construction pass.
+	template <typename tree_key_t, typename meta = iris_overlap_t<tree_key_t>>
+	struct iris_tree_frozen_t {
+		using tree_t = iris_tree_t<tree_key_t, meta>;
+		using key_t = typename tree_t::key_t;
+		using index_t = typename tree_t::index_t;
+
+		static constexpr uint32_t snapshot_magic = 0x54524953u; // 'SIRT'
+		static constexpr uint32_t snapshot_version = 1;
+		static constexpr size_t link_none = ~size_t(0);
+
+		struct node_t {
+			key_t key;
+			index_t key_index;
+			size_t left; // node index, link_none if absent
+			size_t right;
+
+			const key_t& get_key() const noexcept {
+				return key;
+			}
+
+			index_t get_index() const noexcept {
+				return key_index;
+			}
+		};
+
+		struct header_t {
+			uint32_t magic;
+			uint32_t version;
+			uint64_t count;
+		};
+
+		iris_tree_frozen_t() noexcept : nodes(nullptr), count(0) {}
+
+		// serialize the tree into a flat blob appended to out
+		static void freeze(const tree_t* root, std::vector<uint8_t>& out) {
+			// note: std::pair-based keys are not trivially copyable in libstdc++,
+			// trivial copy construction and destruction are what memcpy needs here
+			static_assert(std::is_trivially_copy_constructible<key_t>::value && std::is_trivially_destructible<key_t>::value, "key_t must be trivially copyable to freeze!");
+
+			// collect nodes in bfs order, the root gets index 0
+			std::vector<const tree_t*> all_nodes;
+			if (root != nullptr) {
+				all_nodes.emplace_back(root);
+				size_t n = 0;
+				while (n < all_nodes.size()) {
+					const tree_t* p = all_nodes[n++];
+					if (p->get_left() != nullptr) {
+						all_nodes.emplace_back(p->get_left());
+					}
+
+					if (p->get_right() != nullptr) {
+						all_nodes.emplace_back(p->get_right());
+					}
+				}
+			}
+
+			std::vector<iris_key_value_t<const tree_t*, size_t>> ranks;
+			ranks.reserve(all_nodes.size());
+			for (size_t i = 0; i < all_nodes.size(); i++) {
+				ranks.emplace_back(iris_make_key_value(all_nodes[i], i));
+			}
+
+			std::sort(ranks.begin(), ranks.end());
+
+			header_t header;
+			header.magic = snapshot_magic;
+			header.version = snapshot_version;
+			header.count = all_nodes.size();
+
+			size_t offset = out.size();
+			out.resize(offset + sizeof(header_t) + all_nodes.size() * sizeof(node_t));
+			std::memcpy(&out[offset], &header, sizeof(header_t));
+
+			node_t* target = reinterpret_cast<node_t*>(&out[offset + sizeof(header_t)]);
+			for (size_t i = 0; i < all_nodes.size(); i++) {
+				const tree_t* p = all_nodes[i];
+				node_t node;
+				node.key = p->get_key();
+				node.key_index = p->get_index();
+				node.left = frozen_link(ranks, p->get_left());
+				node.right = frozen_link(ranks, p->get_right());
+				std::memcpy(target + i, &node, sizeof(node_t));
+			}
+		}
+
+		// bind a read-only view over a mapped blob, returns false when malformed.
+		// the node count and every link are validated here, so query() can walk
+		// the blob without per-hop bounds checks even on untrusted input.
+		bool attach(const void* data, size_t size) noexcept {
+			nodes = nullptr;
+			count = 0;
+
+			if (data == nullptr || size < sizeof(header_t)) {
+				return false;
+			}
+
+			IRIS_ASSERT(reinterpret_cast<size_t>(data) % alignof(header_t) == 0);
+			header_t header;
+			std::memcpy(&header, data, sizeof(header_t));
+			if (header.magic != snapshot_magic || header.version != snapshot_version) {
+				return false;
+			}
+
+			// divide instead of multiplying so a hostile count cannot wrap the bound
+			if (header.count > (size - sizeof(header_t)) / sizeof(node_t)) {
+				return false;
+			}
+
+			const node_t* node_base = reinterpret_cast<const node_t*>(reinterpret_cast<const uint8_t*>(data) + sizeof(header_t));
+			size_t node_count = iris_verify_cast<size_t>(header.count);
+			for (size_t i = 0; i < node_count; i++) {
+				if ((node_base[i].left != link_none && node_base[i].left >= node_count) || (node_base[i].right != link_none && node_base[i].right >= node_count)) {
+					return false;
+				}
+			}
+
+			nodes = node_base;
+			count = node_count;
+			return true;
+		}
+
+		size_t get_count() const noexcept {
+			return count;
+		}
+
+		const node_t* get_root() const noexcept {
+			return count != 0 ? nodes : nullptr;
+		}
+
+		// read-only query with the same traversal rules as iris_tree_t::query
+		template <bool right_skew, typename query_key_t, typename queryer_t>
+		bool query(query_key_t&& target_key, queryer_t&& queryer) const noexcept(noexcept(queryer(std::declval<const node_t&>()))) {
+			return count == 0 || query_internal<right_skew>(0, target_key, queryer);
+		}
+
+	protected:
+		static size_t frozen_link(const std::vector<iris_key_value_t<const tree_t*, size_t>>& ranks, const tree_t* link) noexcept {
+			if (link == nullptr) {
+				return link_none;
+			}
+
+			auto it = iris_binary_find(ranks.begin(), ranks.end(), link);
+			IRIS_ASSERT(it != ranks.end());
+			return it->second;
+		}
+
+		template <bool right_skew, typename query_key_t, typename queryer_t>
+		bool query_internal(size_t start, query_key_t&& target_key, queryer_t&& queryer) const {
+			for (size_t i = start; i != link_none; i = (right_skew ? nodes[i].right : nodes[i].left)) {
+				const node_t& p = nodes[i];
+				if (!queryer(p)) {
+					return false;
+				}
+
+				if /* constexpr */ (right_skew) {
+					if (p.left != link_none && meta::overlap_left(p.key, target_key, p.key_index) && !query_internal<right_skew>(p.left, target_key, queryer)) {
+						return false;
+					}
+
+					if (!meta::overlap_right(p.key, target_key, p.key_index))
+						break;
+				} else {
+					if (p.right != link_none && meta::overlap_right(p.key, target_key, p.key_index) && !query_internal<right_skew>(p.right, target_key, queryer)) {
+						return false;
+					}
+
+					if (!meta::overlap_left(p.key, target_key, p.key_index))
+						break;
+				}
+			}
+
+			return true;
+		}
+
+	protected:
+		const node_t* nodes;
+		size_t count;
+	};
+
+	// wait-free read-side snapshots of a tree under concurrent mutation: the
+	// writer keeps mutating its live iris_tree_t and publish()es consistent
+	// frozen snapshots (one freeze pass each, atomically swapped in), while
+	// readers pin an epoch, query the current snapshot through the unchanged
+	// iris_tree_frozen_t::query interface and never block the writer.
+	// replaced snapshots are reclaimed two epochs after retirement, the same
+	// scheme iris_queue_list_t uses for concurrent iteration.
+	template <typename tree_key_t, typename meta = iris_overlap_t<tree_key_t>>
+	struct iris_tree_snapshot_t {
+		using frozen_t = iris_tree_frozen_t<tree_key_t, meta>;
+		using tree_t = typename frozen_t::tree_t;
+
+		iris_tree_snapshot_t() noexcept {
+			current.store(nullptr, std::memory_order_relaxed);
+		}
+
+		iris_tree_snapshot_t(const iris_tree_snapshot_t&) = delete;
+		iris_tree_snapshot_t& operator = (const iris_tree_snapshot_t&) = delete;
+
+		~iris_tree_snapshot_t() noexcept {
+			// no concurrent readers are allowed here
+			delete current.load(std::memory_order_acquire);
+			for (size_t k = 0; k < 3; k++) {
+				for (size_t i = 0; i < retired[k].size(); i++) {
+					delete retired[k][i];
+				}
+			}
+		}
+
+		// writer side: freeze the live tree and swap the snapshot in, called
+		// from the mutating warp only
+		void publish(const tree_t* root) {
+			snapshot_t* snapshot = new snapshot_t();
+			frozen_t::freeze(root, snapshot->blob);
+			bool attached = snapshot->view.attach(snapshot->blob.data(), snapshot->blob.size());
+			IRIS_ASSERT(attached);
+
+			snapshot_t* replaced = current.exchange(snapshot, std::memory_order_release);
+			if (replaced != nullptr) {
+				// retire under the current epoch, reclaim two epochs back
+				size_t epoch = domain.current();
+				retired[epoch % 3].emplace_back(replaced);
+
+				if (domain.try_advance()) {
+					std::vector<snapshot_t*>& stale = retired[(domain.current() + 1) % 3];
+					for (size_t i = 0; i < stale.size(); i++) {
+						delete stale[i];
+					}
+
+					stale.clear();
+				}
+			}
+		}
+
+	protected:
+		struct snapshot_t {
+			std::vector<uint8_t> blob;
+			frozen_t view;
+		};
+
+	public:
+		// reader side: pin the current snapshot; view() is nullptr before the
+		// first publish. wait-free, never blocks the writer.
+		struct reader_guard_t {
+			reader_guard_t(iris_tree_snapshot_t& h) noexcept : host(&h) {
+				epoch = h.domain.reader_enter();
+				snapshot = h.current.load(std::memory_order_acquire);
+			}
+
+			// movable so acquire() can return by value without relying on the
+			// guaranteed elision of C++17, the C++11 configuration needs this
+			reader_guard_t(reader_guard_t&& rhs) noexcept : host(rhs.host), epoch(rhs.epoch), snapshot(rhs.snapshot) {
+				rhs.host = nullptr;
+			}
+
+			~reader_guard_t() noexcept {
+				if (host != nullptr) {
+					host->domain.reader_exit(epoch);
+				}
+			}
+
+			reader_guard_t(const reader_guard_t&) = delete;
+			reader_guard_t& operator = (const reader_guard_t&) = delete;
+			reader_guard_t& operator = (reader_guard_t&&) = delete;
+
+			const frozen_t* view() const noexcept {
+				return snapshot != nullptr ? &snapshot->view : nullptr;
+			}
+
+		private:
+			iris_tree_snapshot_t* host;
+			size_t epoch;
+			snapshot_t* snapshot;
+		};
+
+		reader_guard_t acquire() noexcept {
+			return reader_guard_t(*this);
+		}
+
+	protected:
+		friend struct reader_guard_t;
+
+		impl::epoch_domain_t domain;
+		std::atomic<snapshot_t*> current;
+		std::vector<snapshot_t*> retired[3]; // by epoch mod 3, freed two epochs later
+	};
+
+	// companion pool that owns iris_tree_t nodes in contiguous chunks, with an
+	// explicit repack() that rewrites the tree into one array in bfs order so
+	// query() hops stay within a few cache lines instead of chasing nodes
+	// scattered over the heap. nodes keep the full iris_tree_t surface
+	// (query/attach/detach); individual nodes are not freed, clear() or repack()
+	// recycles storage wholesale.
+	template <typename tree_key_t, typename meta = iris_overlap_t<tree_key_t>>
+	struct iris_tree_pool_t {
+		using tree_t = iris_tree_t<tree_key_t, meta>;
+		using key_t = typename tree_t::key_t;
+		using index_t = typename tree_t::index_t;
+		static constexpr size_t chunk_count = (default_block_size / sizeof(tree_t)) < 4 ? 4 : default_block_size / sizeof(tree_t);
+
+		iris_tree_pool_t() {}
+		iris_tree_pool_t(const iris_tree_pool_t&) = delete;
+		iris_tree_pool_t& operator = (const iris_tree_pool_t&) = delete;
+
+		// allocate a node from the pool, addresses stay stable until clear()/repack()
+		tree_t* allocate(const key_t& key = key_t(), index_t index = 0) {
+			if (chunks.empty() || chunks.back().size() == chunk_count) {
+				chunks.emplace_back();
+				chunks.back().reserve(chunk_count);
+			}
+
+			chunks.back().emplace_back(key, index);
+			return &chunks.back().back();
+		}
+
+		size_t size() const noexcept {
+			size_t count = 0;
+			for (size_t i = 0; i < chunks.size(); i++) {
+				count += chunks[i].size();
+			}
+
+			return count;
+		}
+
+		void clear() noexcept {
+			chunks.clear();
+		}
+
+		template <typename operation_t>
+		void for_each(operation_t&& op) {
+			for (size_t i = 0; i < chunks.size(); i++) {
+				for (size_t k = 0; k < chunks[i].size(); k++) {
+					op(chunks[i][k]);
+				}
+			}
+		}
+
+		// batched broadphase scan over the packed node chunks: keys of each
+		// chunk are tested against the query in contiguous runs through
+		// meta::overlap_batch, and op receives every overlapping node. on
+		// repacked pools this is a linear, simd-friendly sweep without any
+		// pointer chasing.
+		template <typename operation_t>
+		size_t for_each_overlap(const key_t& query, operation_t&& op) {
+			static constexpr size_t batch_count = 8;
+			key_t keys[batch_count];
+			bool results[batch_count];
+			tree_t* batch[batch_count];
+			size_t hit_count = 0;
+
+			for (size_t i = 0; i < chunks.size(); i++) {
+				std::vector<tree_t>& chunk = chunks[i];
+				size_t offset = 0;
+				while (offset < chunk.size()) {
+					size_t count = std::min(batch_count, chunk.size() - offset);
+					for (size_t k = 0; k < count; k++) {
+						batch[k] = &chunk[offset + k];
+						keys[k] = batch[k]->get_key();
+					}
+
+					if (meta::overlap_batch(query, keys, count, results) != 0) {
+						for (size_t k = 0; k < count; k++) {
+							if (results[k]) {
+								op(*batch[k]);
+								hit_count++;
+							}
+						}
+					}
+
+					offset += count;
+				}
+			}
+
+			return hit_count;
+		}
+
+		// rewrite the tree rooted at `root` into a single contiguous array in
+		// bfs order, remapping all links, and recycle the old storage.
+		// returns the new root; all previous node addresses are invalidated.
+		tree_t* repack(tree_t* root) {
+			if (root == nullptr) {
+				return nullptr;
+			}
+
+			// collect old nodes in bfs order
+			std::vector<tree_t*> old_nodes;
+			old_nodes.emplace_back(root);
+			size_t n = 0;
+			while (n < old_nodes.size()) {
+				tree_t* p = old_nodes[n++];
+				if (p->get_left() != nullptr) {
+					old_nodes.emplace_back(p->get_left());
+				}
+
+				if (p->get_right() != nullptr) {
+					old_nodes.emplace_back(p->get_right());
+				}
+			}
+
+			// map old addresses to bfs ranks
+			std::vector<iris_key_value_t<tree_t*, size_t>> ranks;
+			ranks.reserve(old_nodes.size());
+			for (size_t i = 0; i < old_nodes.size(); i++) {
+				ranks.emplace_back(iris_make_key_value(old_nodes[i], i));
+			}
+
+			std::sort(ranks.begin(), ranks.end());
+
+			// copy nodes in bfs order and remap links
+			std::vector<tree_t> packed;
+			packed.reserve(old_nodes.size());
+			for (size_t i = 0; i < old_nodes.size(); i++) {
+				packed.emplace_back(*old_nodes[i]);
+			}
+
+			for (size_t i = 0; i < packed.size(); i++) {
+				remap_link(packed, ranks, packed[i].links.links[0]);
+				remap_link(packed, ranks, packed[i].links.links[1]);
+				remap_link(packed, ranks, packed[i].links.links[2]);
+			}
+
+			chunks.clear();
+			chunks.emplace_back(std::move(packed));
+			return &chunks.back()[0];
+		}
+
+	protected:
+		static void remap_link(std::vector<tree_t>& packed, const std::vector<iris_key_value_t<tree_t*, size_t>>& ranks, tree_t*& link) {
+			if (link != nullptr) {
+				auto it = iris_binary_find(ranks.begin(), ranks.end(), link);
+				IRIS_ASSERT(it != ranks.end());
+				link = &packed[it->second];
+			}
+		}
+
+		std::vector<std::vector<tree_t>> chunks;
+	};
 }
 
@@ -0,0 +1,284 @@
+#include "../src/iris_dispatcher.h"
+#include "../src/iris_common.inl"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+using namespace iris;
+
+// microbenchmark harness for the warp/queue/allocator/dispatcher hot paths.
+// results are emitted as machine-readable csv lines:
+//     benchmark,threads,operations,nanoseconds_per_op,ops_per_sec
+// pass a scale factor as the first argument to lengthen runs (default 1).
+
+static size_t scale = 1;
+
+template <typename proc_t>
+static void report(const char* name, size_t threads, size_t operations, proc_t&& proc) {
+	auto start = std::chrono::steady_clock::now();
+	proc();
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	double ns_per_op = operations == 0 ? 0.0 : (double)elapsed / (double)operations;
+	double ops_per_sec = elapsed == 0 ? 0.0 : (double)operations * 1e9 / (double)elapsed;
+	printf("%s,%d,%d,%.2f,%.0f\n", name, (int)threads, (int)operations, ns_per_op, ops_per_sec);
+}
+
+template <typename element_t>
+using benchmark_allocator_t = iris_object_allocator_t<element_t>;
+
+using worker_t = iris_async_worker_t<std::thread, std::function<void()>, benchmark_allocator_t>;
+
+template <bool strand>
+static void benchmark_warp_throughput(const char* name, size_t thread_count) {
+	static constexpr size_t batch = 4096;
+	size_t rounds = 64 * scale;
+
+	worker_t worker(thread_count);
+	worker.start();
+
+	using warp_t = iris_warp_t<worker_t, strand>;
+	warp_t warp(worker);
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+	size_t total = batch * rounds;
+
+	report(name, thread_count, total, [&]() {
+		for (size_t r = 0; r < rounds; r++) {
+			worker.queue([&warp, &counter, &worker, total]() {
+				for (size_t i = 0; i < batch; i++) {
+					warp.queue_routine_post([&counter, &worker, total]() {
+						if (counter.fetch_add(1, std::memory_order_relaxed) + 1 == total) {
+							worker.terminate();
+						}
+					});
+				}
+			});
+
+			while (counter.load(std::memory_order_acquire) < batch * (r + 1)) {
+				iris_thread_pause();
+			}
+		}
+	});
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join()) {}
+	warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); return true; });
+}
+
+static void benchmark_queue_list() {
+	size_t operations = 1000000 * scale;
+	iris_queue_list_t<size_t> queue;
+
+	report("queue_list_push_pop", 1, operations * 2, [&]() {
+		for (size_t i = 0; i < operations; i++) {
+			queue.push(i);
+		}
+
+		while (!queue.empty()) {
+			queue.pop();
+		}
+	});
+}
+
+static void benchmark_allocator(size_t thread_count) {
+	size_t operations = 100000 * scale;
+
+	struct payload_t {
+		size_t data[8];
+	};
+
+	iris_allocator_t<sizeof(payload_t)> allocator;
+	report("allocator_alloc_free", thread_count, operations * thread_count * 2, [&]() {
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < thread_count; t++) {
+			threads.emplace_back([&allocator, operations]() {
+				std::vector<void*> slots;
+				slots.reserve(64);
+
+				for (size_t i = 0; i < operations; i++) {
+					slots.emplace_back(allocator.allocate_safe());
+					if (slots.size() == 64) {
+						for (size_t k = 0; k < slots.size(); k++) {
+							iris_allocator_t<sizeof(payload_t)>::deallocate_safe(slots[k]);
+						}
+
+						slots.clear();
+					}
+				}
+
+				for (size_t k = 0; k < slots.size(); k++) {
+					iris_allocator_t<sizeof(payload_t)>::deallocate_safe(slots[k]);
+				}
+			});
+		}
+
+		for (size_t t = 0; t < threads.size(); t++) {
+			threads[t].join();
+		}
+	});
+}
+
+static void benchmark_dispatcher_graph(size_t thread_count) {
+	static constexpr size_t chain_length = 64;
+	size_t rounds = 256 * scale;
+
+	worker_t worker(thread_count);
+	worker.start();
+
+	using warp_t = iris_warp_t<worker_t>;
+	using dispatcher_t = iris_dispatcher_t<warp_t>;
+	dispatcher_t dispatcher(worker);
+
+	report("dispatcher_linear_chain", thread_count, rounds * chain_length, [&]() {
+		for (size_t r = 0; r < rounds; r++) {
+			std::atomic<size_t> remaining;
+			remaining.store(chain_length, std::memory_order_relaxed);
+
+			typename dispatcher_t::routine_t* nodes[chain_length];
+			for (size_t i = 0; i < chain_length; i++) {
+				nodes[i] = dispatcher.allocate(nullptr, [&remaining]() {
+					remaining.fetch_sub(1, std::memory_order_release);
+				});
+			}
+
+			for (size_t i = 1; i < chain_length; i++) {
+				dispatcher.order(nodes[i - 1], nodes[i]);
+			}
+
+			for (size_t i = 0; i < chain_length; i++) {
+				dispatcher.dispatch(nodes[i]);
+			}
+
+			dispatcher.wait_for_completion();
+			IRIS_ASSERT(remaining.load(std::memory_order_acquire) == 0);
+		}
+	});
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join()) {}
+}
+
+// contended-scaling stress: sweep worker thread counts and measure tasks/sec
+// plus idle wake latency. compared against a stored baseline csv, returning
+// nonzero when throughput regressed beyond the threshold; the baseline file is
+// created on the first run.
+static int benchmark_scaling(const char* baseline_path, double threshold_percent) {
+	size_t hardware = std::max((size_t)std::thread::hardware_concurrency(), (size_t)1);
+	std::vector<std::pair<size_t, double>> measured;
+
+	for (size_t thread_count = 1; thread_count <= hardware && thread_count <= 64; thread_count *= 2) {
+		size_t task_count = 100000 * scale;
+
+		worker_t worker(thread_count);
+		worker.start();
+
+		std::atomic<size_t> counter;
+		counter.store(0, std::memory_order_relaxed);
+
+		static std::atomic<size_t> grain_sink; // keeps the task grain observable
+
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < task_count; i++) {
+			worker.queue([&counter]() {
+				// small configurable grain
+				size_t sum = 0;
+				for (size_t k = 0; k < 16; k++) {
+					sum += k;
+				}
+
+				grain_sink.store(sum, std::memory_order_relaxed);
+				counter.fetch_add(1, std::memory_order_relaxed);
+			});
+		}
+
+		while (counter.load(std::memory_order_acquire) < task_count) {
+			iris_thread_pause();
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		double tasks_per_sec = (double)task_count * 1e9 / (double)std::max<long long>(elapsed, 1);
+
+		// wake latency: queue one task into an idle pool and time the handoff
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		std::atomic<long long> wake_ns;
+		wake_ns.store(0, std::memory_order_relaxed);
+		auto wake_start = std::chrono::steady_clock::now();
+		worker.queue([&wake_ns, wake_start]() {
+			wake_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wake_start).count(), std::memory_order_release);
+		});
+
+		while (wake_ns.load(std::memory_order_acquire) == 0) {
+			iris_thread_pause();
+		}
+
+		printf("scaling,%d,%d,%.0f,%lld\n", (int)thread_count, (int)task_count, tasks_per_sec, (long long)wake_ns.load(std::memory_order_relaxed));
+		measured.emplace_back(thread_count, tasks_per_sec);
+
+		worker.terminate();
+		worker.finalize();
+		while (!worker.join()) {}
+	}
+
+	FILE* baseline = fopen(baseline_path, "r");
+	if (baseline == nullptr) {
+		// first run, store the baseline
+		baseline = fopen(baseline_path, "w");
+		if (baseline == nullptr) {
+			IRIS_LOGERROR("cannot write baseline file %s\n", baseline_path);
+			return 1;
+		}
+
+		for (size_t i = 0; i < measured.size(); i++) {
+			fprintf(baseline, "%d,%.0f\n", (int)measured[i].first, measured[i].second);
+		}
+
+		fclose(baseline);
+		printf("baseline stored to %s\n", baseline_path);
+		return 0;
+	}
+
+	int exit_code = 0;
+	int threads = 0;
+	double baseline_tasks_per_sec = 0;
+	while (fscanf(baseline, "%d,%lf\n", &threads, &baseline_tasks_per_sec) == 2) {
+		for (size_t i = 0; i < measured.size(); i++) {
+			if (measured[i].first == (size_t)threads) {
+				double floor_tasks_per_sec = baseline_tasks_per_sec * (100.0 - threshold_percent) / 100.0;
+				if (measured[i].second < floor_tasks_per_sec) {
+					IRIS_LOGERROR("regression at %d threads: %.0f tasks/sec vs baseline %.0f (floor %.0f)\n", threads, measured[i].second, baseline_tasks_per_sec, floor_tasks_per_sec);
+					exit_code = 1;
+				}
+			}
+		}
+	}
+
+	fclose(baseline);
+	return exit_code;
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && strcmp(argv[1], "scaling") == 0) {
+		scale = argc > 4 ? (size_t)std::max(1, atoi(argv[4])) : 1;
+		return benchmark_scaling(argc > 2 ? argv[2] : "iris_benchmark_baseline.csv", argc > 3 ? atof(argv[3]) : 25.0);
+	}
+
+	if (argc > 1) {
+		scale = (size_t)std::max(1, atoi(argv[1]));
+	}
+
+	printf("benchmark,threads,operations,nanoseconds_per_op,ops_per_sec\n");
+
+	benchmark_warp_throughput<true>("warp_strand_post", 4);
+	benchmark_warp_throughput<false>("warp_grid_post", 4);
+	benchmark_queue_list();
+
+	size_t hardware = std::max((size_t)std::thread::hardware_concurrency(), (size_t)1);
+	for (size_t t = 1; t <= hardware && t <= 64; t *= 2) {
+		benchmark_allocator(t);
+	}
+
+	benchmark_dispatcher_graph(4);
+	return 0;
+}
@@ -34,6 +34,202 @@ int main(void) {
 	combined.resize(bytes.get_view_size());
 	combined.copy(0, bytes);
 
+	// scatter-gather export: segments of the view chain, no copying
+	do {
+		size_t segment_count = 0;
+		size_t total = 0;
+		bytes.for_each_segment([&segment_count, &total](const uint8_t* data, size_t length) {
+			IRIS_ASSERT(data != nullptr && length != 0);
+			segment_count++;
+			total += length;
+		});
+
+		IRIS_ASSERT(segment_count == bytes.get_segment_count());
+		IRIS_ASSERT(total == bytes.get_view_size());
+		IRIS_ASSERT(combined.get_segment_count() == 1); // flat buffers yield one segment
+	} while (false);
+
+	// rope-style appending through the cache, then linearize once
+	do {
+		iris_cache_t<uint8_t> rope_cache;
+		iris_bytes_t rope;
+		std::vector<uint8_t> expected;
+
+		for (size_t i = 0; i < 256; i++) {
+			uint8_t chunk[97];
+			for (size_t k = 0; k < sizeof(chunk); k++) {
+				chunk[k] = (uint8_t)(i + k);
+				expected.push_back(chunk[k]);
+			}
+
+			rope_cache.append(rope, chunk, sizeof(chunk));
+		}
+
+		IRIS_ASSERT(rope.get_view_size() == expected.size());
+		rope.linearize();
+		IRIS_ASSERT(!rope.is_view_storage());
+		IRIS_ASSERT(rope.get_size() == expected.size());
+		IRIS_ASSERT(std::memcmp(rope.get_data(), expected.data(), expected.size()) == 0);
+	} while (false);
+
+	// repeat copy and fill kernels
+	do {
+		iris_bytes_t blit;
+		blit.resize(1024);
+
+		uint8_t tile[7] = { 1, 2, 3, 4, 5, 6, 7 };
+		blit.copy(0, tile, sizeof(tile), 1024 / sizeof(tile));
+		for (size_t i = 0; i < 1024 - sizeof(tile); i++) {
+			IRIS_ASSERT(blit[i] == tile[i % sizeof(tile)]);
+		}
+
+		blit.fill(16, (uint8_t)0xcd, 1000);
+		for (size_t i = 16; i < 16 + 1000; i++) {
+			IRIS_ASSERT(blit[i] == 0xcd);
+		}
+
+		// fill across view segments
+		iris_cache_t<uint8_t> fill_cache;
+		iris_bytes_t chain = fill_cache.allocate(3000);
+		chain.fill(0, (uint8_t)0x5a, 3000);
+		chain.for_each_segment([](const uint8_t* data, size_t length) {
+			for (size_t i = 0; i < length; i++) {
+				IRIS_ASSERT(data[i] == 0x5a);
+			}
+		});
+	} while (false);
+
+	// slab recycling: clear_keep retains slabs across frames, trim reclaims
+	do {
+		iris_cache_t<uint8_t> frame_cache;
+		for (size_t frame = 0; frame < 4; frame++) {
+			for (size_t i = 0; i < 64; i++) {
+				frame_cache.allocate(1000);
+			}
+
+			size_t high_water = frame_cache.get_node_count();
+			IRIS_ASSERT(high_water > 1);
+			frame_cache.clear_keep(high_water * iris_cache_t<uint8_t>::full_pack_size());
+			IRIS_ASSERT(frame_cache.get_node_count() == high_water); // slabs retained
+		}
+
+		size_t before_trim = frame_cache.get_node_count();
+		frame_cache.trim(4 * iris_cache_t<uint8_t>::full_pack_size());
+		IRIS_ASSERT(frame_cache.get_node_count() < before_trim);
+		frame_cache.trim(0);
+		IRIS_ASSERT(frame_cache.get_node_count() == 1); // only the active slab remains
+
+		frame_cache.allocate(100); // still usable after trimming
+	} while (false);
+
+	// block-level cache cloning: snapshot by memcpy per node run
+	do {
+		iris_cache_t<uint8_t> frame_state;
+		for (size_t i = 0; i < 32; i++) {
+			iris_bytes_t slab = frame_state.allocate(777);
+			slab.fill(0, (uint8_t)(i * 3), 777);
+		}
+
+		iris_cache_t<uint8_t> snapshot;
+		snapshot.clone_from(frame_state);
+
+		std::vector<uint8_t> original_bytes;
+		frame_state.for_each_data([&original_bytes](const uint8_t* data, size_t count) {
+			original_bytes.insert(original_bytes.end(), data, data + count);
+		});
+
+		std::vector<uint8_t> snapshot_bytes;
+		snapshot.for_each_data([&snapshot_bytes](const uint8_t* data, size_t count) {
+			snapshot_bytes.insert(snapshot_bytes.end(), data, data + count);
+		});
+
+		IRIS_ASSERT(!original_bytes.empty());
+		IRIS_ASSERT(original_bytes == snapshot_bytes);
+
+		// mutating the source leaves the snapshot untouched
+		frame_state.allocate(100).fill(0, (uint8_t)0xee, 100);
+		snapshot_bytes.clear();
+		snapshot.for_each_data([&snapshot_bytes](const uint8_t* data, size_t count) {
+			snapshot_bytes.insert(snapshot_bytes.end(), data, data + count);
+		});
+
+		IRIS_ASSERT(original_bytes == snapshot_bytes);
+	} while (false);
+
+	// memory introspection across the allocator stack
+	do {
+		iris_memory_stats_t total;
+		total += cache.get_memory_stats();
+		total += iris_root_allocator_t<default_block_size, default_page_size / default_block_size>::get().get_memory_stats();
+
+		iris_queue_list_t<int> stats_queue;
+		for (int i = 0; i < 3000; i++) {
+			stats_queue.push(i);
+		}
+
+		iris_memory_stats_t queue_stats = stats_queue.get_memory_stats();
+		IRIS_ASSERT(queue_stats.block_count >= 3000 * sizeof(int) / default_block_size);
+		IRIS_ASSERT(queue_stats.bytes_in_use == 3000 * sizeof(int));
+		IRIS_ASSERT(queue_stats.bytes_reserved >= queue_stats.bytes_in_use);
+		total += queue_stats;
+
+		iris_allocator_t<64> object_allocator;
+		void* slot = object_allocator.allocate_safe();
+		iris_memory_stats_t allocator_stats = object_allocator.get_memory_stats();
+		IRIS_ASSERT(allocator_stats.block_count == 1);
+		IRIS_ASSERT(allocator_stats.bytes_reserved == default_block_size);
+		iris_allocator_t<64>::deallocate_safe(slot);
+		total += allocator_stats;
+
+		printf("aggregated memory: %d bytes reserved in %d blocks, high water %d\n",
+			(int)total.bytes_reserved, (int)total.block_count, (int)total.high_water_bytes);
+	} while (false);
+
+	// frozen key-value store: build once, attach anywhere, O(log n) lookups
+	do {
+		using frozen_map_t = iris_frozen_map_t<uint64_t, uint32_t>;
+		std::vector<frozen_map_t::pair_t> entries;
+		for (uint64_t k = 0; k < 10000; k++) {
+			entries.emplace_back(iris::iris_make_key_value(k * 7 + 1, (uint32_t)(k & 0xffff)));
+		}
+
+		std::vector<uint8_t> blob;
+		frozen_map_t::build(entries, blob);
+
+		frozen_map_t map;
+		bool malformed_rejected = !map.attach(blob.data(), 4); // malformed input rejected
+		IRIS_ASSERT(malformed_rejected);
+
+		// a hostile count that would wrap the size arithmetic is rejected
+		std::vector<uint8_t> hostile(blob.begin(), blob.begin() + sizeof(frozen_map_t::header_t));
+		uint64_t wrapping_count = ~uint64_t(0) / sizeof(frozen_map_t::pair_t) + 1;
+		std::memcpy(&hostile[8], &wrapping_count, sizeof(wrapping_count)); // count field
+		bool hostile_rejected = !map.attach(hostile.data(), hostile.size());
+		IRIS_ASSERT(hostile_rejected);
+		bool attached = map.attach(blob.data(), blob.size());
+		IRIS_ASSERT(attached);
+		IRIS_ASSERT(map.size() == 10000);
+
+		for (uint64_t k = 0; k < 10000; k += 17) {
+			const uint32_t* value = map.find(k * 7 + 1);
+			IRIS_ASSERT(value != nullptr && *value == (uint32_t)(k & 0xffff));
+			const uint32_t* miss = map.find(k * 7 + 2); // miss between keys
+			IRIS_ASSERT(miss == nullptr);
+		}
+
+		const uint32_t* below_range = map.find(0);
+		IRIS_ASSERT(below_range == nullptr);
+
+		// the blob round-trips through iris_bytes_t untouched
+		iris_bytes_t stored;
+		stored.assign(blob.data(), blob.size());
+		frozen_map_t reopened;
+		bool reattached = reopened.attach(stored.get_data(), stored.get_size());
+		IRIS_ASSERT(reattached);
+		const uint32_t* reopened_value = reopened.find(8);
+		IRIS_ASSERT(reopened_value != nullptr);
+	} while (false);
+
 	// todo: more tests
 	std::vector<double, iris_cache_allocator_t<double, uint8_t>> vec(allocator);
 	vec.push_back(1234.0f);
@@ -1,4 +1,5 @@
 #include "../src/iris_coroutine.h"
+#include "../src/iris_file.h"
 #include "../src/iris_common.inl"
 #include <chrono>
 using namespace iris;
@@ -13,6 +14,158 @@ using quota_t = iris_quota_t<int, 2>;
 using quota_queue_t = iris_quota_queue_t<quota_t, warp_t>;
 static std::atomic<size_t> pending_count = 0;
 
+using channel_t = iris_channel_t<int, warp_t>;
+using timer_wheel_t = iris_timer_wheel_t<worker_t>;
+
+using shared_lock_t = iris_shared_lock_t<warp_t>;
+
+coroutine_t rwlock_reader(shared_lock_t& rwlock, std::atomic<int>& writers_inside, std::atomic<int>& done) {
+	co_await rwlock.lock_shared();
+	IRIS_ASSERT(writers_inside.load(std::memory_order_acquire) == 0); // no writer while reading
+	std::this_thread::sleep_for(std::chrono::microseconds(10));
+	rwlock.unlock_shared();
+	done.fetch_add(1, std::memory_order_release);
+}
+
+coroutine_t rwlock_writer(shared_lock_t& rwlock, std::atomic<int>& writers_inside, std::atomic<int>& done) {
+	co_await rwlock.lock_unique();
+	IRIS_ASSERT(writers_inside.fetch_add(1, std::memory_order_acq_rel) == 0); // exclusive
+	std::this_thread::sleep_for(std::chrono::microseconds(50));
+	writers_inside.fetch_sub(1, std::memory_order_acq_rel);
+	rwlock.unlock_unique();
+	done.fetch_add(1, std::memory_order_release);
+}
+
+coroutine_t event_waiter(iris_event_t<warp_t>& event, warp_t* warp, std::atomic<int>& resumed) {
+	if (warp != nullptr) {
+		co_await iris_switch(warp);
+	}
+
+	co_await event;
+	resumed.fetch_add(1, std::memory_order_release);
+}
+
+coroutine_t example_file(worker_t& io_pool, warp_t* warp, const char* path) {
+	warp_t* current = co_await iris_switch(warp);
+
+	iris_file_t<worker_t> file(io_pool);
+	bool opened = file.open(path, "w+b");
+	IRIS_ASSERT(opened);
+
+	iris_bytes_t payload;
+	payload.assign(reinterpret_cast<const uint8_t*>("iris file layer"), 15);
+	size_t written = co_await file.write_at<warp_t>(0, payload);
+	IRIS_ASSERT(written == payload.get_size());
+	IRIS_ASSERT(warp_t::get_current_warp() == warp); // resumed on our warp
+
+	iris_bytes_t readback;
+	readback.resize(payload.get_size());
+	size_t read = co_await file.read_at<warp_t>(0, readback);
+	IRIS_ASSERT(read == payload.get_size());
+	IRIS_ASSERT(readback == payload);
+	IRIS_ASSERT(file.get_size() == payload.get_size());
+
+	file.close();
+	remove(path);
+
+	co_await iris_switch(current);
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
+coroutine_t example_blocking(worker_t& blocking_pool, warp_t* warp) {
+	warp_t* current = co_await iris_switch(warp);
+
+	// blocking call shunted to the dedicated sub-pool, warp thread stays free
+	int result = co_await iris_blocking<warp_t>(blocking_pool, []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		return 77;
+	});
+
+	IRIS_ASSERT(result == 77);
+	IRIS_ASSERT(warp_t::get_current_warp() == warp);
+
+	do {
+		// unavoidable inline blocking: lift the thread limit meanwhile
+		worker_t::blocking_guard_t guard(warp->get_async_worker());
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	} while (false);
+
+	co_await iris_switch(current);
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
+coroutine_t example_delay(timer_wheel_t& wheel) {
+	auto start = std::chrono::steady_clock::now();
+	bool completed = co_await iris_delay<warp_t>(wheel, 20);
+	IRIS_ASSERT(completed);
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	printf("delayed for %d ms\n", (int)elapsed);
+	IRIS_ASSERT(elapsed >= 10);
+
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
+coroutine_t bounded_producer(warp_t& slow_warp, std::atomic<size_t>& delivered, size_t total) {
+	for (size_t i = 0; i < total; i++) {
+		while (!slow_warp.try_queue_routine_post([&delivered]() {
+			delivered.fetch_add(1, std::memory_order_release);
+		})) {
+			// saturated: suspend until the warp drains below the low-water mark
+			co_await iris_backpressure(slow_warp, slow_warp.get_pending_limit() / 2);
+		}
+
+		IRIS_ASSERT(slow_warp.get_pending_task_count() <= slow_warp.get_pending_limit() + 1);
+	}
+
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
+coroutine_t channel_producer(channel_t& channel, int count) {
+	for (int i = 0; i < count; i++) {
+		co_await channel.push(i); // suspends when the channel is full
+	}
+}
+
+coroutine_t channel_consumer(channel_t& channel, int count, std::atomic<int>& sum) {
+	for (int i = 0; i < count; i++) {
+		int value = co_await channel.pop(); // suspends when the channel is empty
+		sum.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
+coroutine_t example_combinators(worker_t& worker) {
+	// all three run concurrently, one resume via a single countdown
+	auto results = co_await iris_when_all<warp_t>(worker,
+		[]() { return 1; },
+		[]() {},
+		[]() { return 2.5; });
+
+	IRIS_ASSERT(std::get<0>(results) == 1);
+	IRIS_ASSERT(std::get<2>(results) == 2.5);
+
+	// first completion wins, losers keep running detached
+	auto winner = co_await iris_when_any<warp_t>(worker,
+		[]() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); return 7; },
+		[]() { return 11; });
+
+	IRIS_ASSERT(winner.second == 7 || winner.second == 11);
+	printf("when_any winner: %d = %d\n", (int)winner.first, winner.second);
+
+	// a cancelled awaitable resumes immediately without running its func
+	iris_cancellation_token_t token;
+	token.cancel();
+	auto awaitable = iris_awaitable((warp_t*)nullptr, []() { IRIS_ASSERT(false); return 5; });
+	awaitable.set_cancellation(&token);
+	int cancelled_result = co_await awaitable;
+	IRIS_ASSERT(awaitable.is_cancelled());
+	IRIS_ASSERT(cancelled_result == 0);
+
+	pending_count.fetch_sub(1, std::memory_order_release);
+}
+
 coroutine_t cascade(warp_t* warp) {
 	warp_t* w = co_await iris_switch(warp);
 	printf("Cascaded!\n");
@@ -211,6 +364,107 @@ int main(void) {
 		example_barrier(worker, barrier_warp, 8).run();
 	});
 
+	// awaitable read-write lock: many readers, occasional exclusive writers
+	do {
+		static constexpr int reader_total = 60;
+		static constexpr int writer_total = 6;
+		shared_lock_t rwlock(worker);
+		std::atomic<int> writers_inside;
+		writers_inside.store(0, std::memory_order_relaxed);
+		std::atomic<int> done;
+		done.store(0, std::memory_order_relaxed);
+
+		for (int i = 0; i < reader_total; i++) {
+			rwlock_reader(rwlock, writers_inside, done).run();
+			if (i % 10 == 9) {
+				rwlock_writer(rwlock, writers_inside, done).run();
+			}
+		}
+
+		while (done.load(std::memory_order_acquire) < reader_total + writer_total) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	} while (false);
+
+	// batched event notification: warpless and same-warp waiters resume in bulk
+	do {
+		static constexpr int waiter_count = 200;
+		iris_event_t<warp_t> event(worker);
+		std::atomic<int> resumed;
+		resumed.store(0, std::memory_order_relaxed);
+
+		for (int i = 0; i < waiter_count; i++) {
+			event_waiter(event, (i & 1) != 0 ? &warps[i % warp_count] : nullptr, resumed).run();
+		}
+
+		event.notify();
+		while (resumed.load(std::memory_order_acquire) < waiter_count) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	} while (false);
+
+	// when_all/when_any combinators
+	pending_count.fetch_add(1, std::memory_order_release);
+	example_combinators(worker).run();
+
+	// timer wheel: awaitable delay plus O(1) arm/cancel
+	timer_wheel_t wheel(worker, 1);
+	std::atomic<bool> ticker_stop;
+	ticker_stop.store(false, std::memory_order_relaxed);
+	std::thread ticker([&wheel, &ticker_stop]() {
+		while (!ticker_stop.load(std::memory_order_acquire)) {
+			wheel.tick();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	});
+
+	timer_wheel_t::handle_t cancelled_timer = wheel.arm(100000, []() { IRIS_ASSERT(false); });
+	bool cancelled = wheel.cancel(cancelled_timer);
+	IRIS_ASSERT(cancelled);
+	bool cancelled_twice = wheel.cancel(cancelled_timer);
+	IRIS_ASSERT(!cancelled_twice); // double cancel rejected
+
+	// a delay whose tick count is an exact wheel multiple fires on its first
+	// eligible lap instead of one full lap late; checked at the end of main so
+	// the wait does not stall the registration of the remaining examples
+	std::atomic<long long> lap_elapsed;
+	lap_elapsed.store(-1, std::memory_order_relaxed);
+	auto lap_start = std::chrono::steady_clock::now();
+	wheel.arm(255, [&lap_elapsed, lap_start]() { // 256 ticks at 1ms, wheel size 256
+		lap_elapsed.store(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lap_start).count(), std::memory_order_release);
+	});
+
+	pending_count.fetch_add(1, std::memory_order_release);
+	example_delay(wheel).run();
+
+	// blocking sub-pool for legacy blocking calls
+	iris_async_worker_t<> blocking_pool(1);
+	blocking_pool.start();
+	pending_count.fetch_add(1, std::memory_order_release);
+	example_blocking(blocking_pool, &warps[1]).run();
+
+	// async file i/o through the i/o sub-pool
+	pending_count.fetch_add(1, std::memory_order_release);
+	example_file(blocking_pool, &warps[2], "iris_coroutine_demo_file.tmp").run();
+
+	// bounded warp with producer throttling
+	warp_t bounded_warp(worker);
+	bounded_warp.set_pending_limit(32);
+	std::atomic<size_t> bounded_delivered;
+	bounded_delivered.store(0, std::memory_order_relaxed);
+	static constexpr size_t bounded_total = 2000;
+	pending_count.fetch_add(1, std::memory_order_release);
+	bounded_producer(bounded_warp, bounded_delivered, bounded_total).run();
+
+	// bounded channel with backpressure
+	pending_count.fetch_add(1, std::memory_order_release);
+	channel_t channel(worker, 4);
+	std::atomic<int> channel_sum;
+	channel_sum.store(0, std::memory_order_relaxed);
+	static constexpr int channel_item_count = 100;
+	channel_consumer(channel, channel_item_count, channel_sum).run();
+	channel_producer(channel, channel_item_count).run();
+
 	// initialize pending count with `example` call count
 	pending_count.fetch_add(30, std::memory_order_acq_rel);
 
@@ -250,9 +504,33 @@ int main(void) {
 	while (!worker.join() || !warp_t::join(warps.begin(), warps.end(), []() {
 		std::this_thread::sleep_for(std::chrono::milliseconds(50));
 		return false;
+	}) || !bounded_warp.join([]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return true;
 	})) {
 	}
 
+	IRIS_ASSERT(bounded_delivered.load(std::memory_order_acquire) == bounded_total);
+
+	IRIS_ASSERT(channel_sum.load(std::memory_order_acquire) == channel_item_count * (channel_item_count - 1) / 2);
+
+	while (lap_elapsed.load(std::memory_order_acquire) < 0) {
+		// if the wheel fires after termination, the callback is parked on the
+		// worker's default list and only join() executes it
+		worker.join();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	printf("wheel-multiple delay fired after %d ms\n", (int)lap_elapsed.load(std::memory_order_relaxed));
+	IRIS_ASSERT(lap_elapsed.load(std::memory_order_relaxed) < 480); // the off-by-one-lap bug deferred this to ~512ms
+
+	ticker_stop.store(true, std::memory_order_release);
+	ticker.join();
+
+	blocking_pool.terminate();
+	blocking_pool.finalize();
+	while (!blocking_pool.join()) {}
+
 	return 0;
 }
 
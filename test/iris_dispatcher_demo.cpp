@@ -1,3 +1,6 @@
+#define IRIS_ENABLE_STATS 1
+#define IRIS_DEBUG_FALSE_SHARING 1
+#define IRIS_ENABLE_REPLAY 1
 #include "../src/iris_dispatcher.h"
 #include "../src/iris_common.inl"
 #include <cstdio>
@@ -6,6 +9,26 @@
 using namespace iris;
 
 static void external_poll();
+static void work_stealing();
+static void batch_submission();
+static void inline_function_warp();
+static void mpmc_queue();
+static void priority_inheritance();
+static void record_replay();
+static void shm_transport();
+static void warp_allocator();
+static void epoch_iteration();
+static void deadline_lane();
+static void warp_pipeline();
+static void adaptive_warp();
+static void auto_scaling();
+static void inline_recursion();
+static void time_sliced();
+static void task_groups();
+static void federation();
+static void resume_coalescing();
+static void static_warp();
+static void shared_join();
 static void stack_op();
 static void not_pow_two();
 static void framed_data();
@@ -13,10 +36,33 @@ static void simple_explosion();
 static void garbage_collection();
 static void acquire_release();
 static void graph_dispatch();
+static void graph_cancellation();
+static void graph_fusion();
+static void graph_arena();
 static void graph_dispatch_exception();
 
 int main(void) {
 	external_poll();
+	work_stealing();
+	batch_submission();
+	inline_function_warp();
+	mpmc_queue();
+	priority_inheritance();
+	record_replay();
+	shm_transport();
+	warp_allocator();
+	epoch_iteration();
+	deadline_lane();
+	warp_pipeline();
+	adaptive_warp();
+	auto_scaling();
+	inline_recursion();
+	time_sliced();
+	task_groups();
+	federation();
+	resume_coalescing();
+	static_warp();
+	shared_join();
 	stack_op();
 	not_pow_two();
 	framed_data();
@@ -24,6 +70,9 @@ int main(void) {
 	garbage_collection();
 	acquire_release();
 	graph_dispatch();
+	graph_cancellation();
+	graph_fusion();
+	graph_arena();
 	graph_dispatch_exception();
 
 	return 0;
@@ -81,6 +130,962 @@ void external_poll() {
 	worker.finalize();
 }
 
+void work_stealing() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t task_count = 4096;
+
+	using worker_t = iris_async_worker_t<std::thread, std::function<void()>, worker_allocator_t, 4, 4, true>;
+	worker_t worker(thread_count);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : work_stealing ]]\n");
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	for (size_t i = 0; i < task_count; i++) {
+		worker.queue([&worker, &counter]() {
+			// fan out a sub task from the pool thread, it goes to the private deque
+			worker.queue([&worker, &counter]() {
+				if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == task_count * 2) {
+					worker.terminate();
+				}
+			});
+
+			if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == task_count * 2) {
+				worker.terminate();
+			}
+		});
+	}
+
+	worker.finalize();
+	while (!worker.join()) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == task_count * 2);
+}
+
+void batch_submission() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t batch_size = 2048;
+
+	using worker_t = iris_async_worker_t<std::thread, std::function<void()>, worker_allocator_t>;
+	worker_t worker(thread_count);
+	worker.set_aging_interval(1); // exercise the task aging pass on low-priority tasks
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : batch_submission ]]\n");
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	std::vector<std::function<void()>> batch;
+	batch.reserve(batch_size);
+	for (size_t i = 0; i < batch_size; i++) {
+		batch.emplace_back([&worker, &counter]() {
+			if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size) {
+				worker.terminate();
+			}
+		});
+	}
+
+	worker.queue_batch(batch.begin(), batch.end(), 1);
+	worker.finalize();
+	while (!worker.join()) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == batch_size);
+
+	worker_t::latency_histogram_t histogram = worker.get_latency_histogram(1);
+	size_t histogram_total = 0;
+	for (size_t i = 0; i < worker_t::latency_bucket_count; i++) {
+		histogram_total += histogram.buckets[i];
+	}
+
+	IRIS_ASSERT(histogram_total == batch_size);
+	printf("batch submission p99 latency: %d us\n", (int)worker.get_latency_percentile(1, 99));
+}
+
+void inline_function_warp() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t routine_count = 1024;
+
+	// thread-local magazine allocator on the task hot path
+	using worker_t = iris_async_worker_t<std::thread, std::function<void()>, iris_default_magazine_allocator_t>;
+	// grid warp whose routines live inline in the queue ring, no per-task allocation
+	using warp_t = iris_warp_t<worker_t, false, void, iris_inline_function_t<void()>>;
+
+	worker_t worker(thread_count);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : inline_function_warp ]]\n");
+
+	warp_t warp(worker);
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	worker.queue([&worker, &warp, &counter]() {
+		for (size_t i = 0; i < routine_count; i++) {
+			warp.queue_routine_post([&counter]() {
+				counter.fetch_add(1, std::memory_order_acq_rel);
+			});
+		}
+
+		// large capture exercises the heap fallback path
+		std::array<size_t, 16> payload;
+		payload.fill(1);
+		warp.queue_routine_post([&worker, &counter, payload]() {
+			counter.fetch_add(payload[0], std::memory_order_acq_rel);
+			worker.terminate();
+		});
+	});
+
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == routine_count + 1);
+}
+
+void mpmc_queue() {
+	static constexpr size_t producer_count = 2;
+	static constexpr size_t consumer_count = 2;
+	static constexpr size_t item_count = 8192;
+
+	printf("[[ demo for iris dispatcher : mpmc_queue ]]\n");
+
+	iris_queue_select_t<size_t, iris_default_block_allocator_t, true> queue;
+	std::atomic<size_t> sum;
+	sum.store(0, std::memory_order_relaxed);
+	std::atomic<size_t> popped;
+	popped.store(0, std::memory_order_relaxed);
+
+	std::vector<std::thread> threads;
+	for (size_t p = 0; p < producer_count; p++) {
+		threads.emplace_back([&queue, p]() {
+			for (size_t i = p; i < item_count; i += producer_count) {
+				while (!queue.push(i)) {
+					iris_thread_pause();
+				}
+			}
+		});
+	}
+
+	for (size_t c = 0; c < consumer_count; c++) {
+		threads.emplace_back([&queue, &sum, &popped]() {
+			size_t value;
+			while (popped.load(std::memory_order_acquire) < item_count) {
+				if (queue.pop(value)) {
+					sum.fetch_add(value, std::memory_order_relaxed);
+					popped.fetch_add(1, std::memory_order_release);
+				} else {
+					iris_thread_pause();
+				}
+			}
+		});
+	}
+
+	for (size_t i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
+
+	IRIS_ASSERT(sum.load(std::memory_order_acquire) == item_count * (item_count - 1) / 2);
+	IRIS_ASSERT(queue.empty());
+}
+
+void priority_inheritance() {
+	static constexpr size_t thread_count = 2;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : priority_inheritance ]]\n");
+
+	warp_t high(worker, 0);
+	warp_t low(worker, 1);
+	IRIS_ASSERT(low.get_effective_priority() == 1);
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	low.suspend(); // hold execution so the boost is observable
+	do {
+		// posting from the high-priority warp boosts the low one until it yields
+		warp_t::preempt_guard_t preempt_guard(high, 0);
+		IRIS_ASSERT(preempt_guard);
+		low.queue_routine_post([&worker, &counter]() {
+			if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == 1) {
+				worker.terminate();
+			}
+		});
+
+		IRIS_ASSERT(low.get_effective_priority() == 0);
+	} while (false);
+
+	low.resume();
+
+	worker.finalize();
+	while (!worker.join() || !low.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; }) ||
+		!high.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == 1);
+	IRIS_ASSERT(low.get_effective_priority() == 1); // boost restored at yield
+}
+
+void record_replay() {
+	static constexpr size_t task_count = 64;
+
+	printf("[[ demo for iris dispatcher : record_replay ]]\n");
+
+	// record a racy run on two threads
+	std::vector<size_t> log;
+	std::vector<size_t> recorded_order;
+	std::mutex order_mutex;
+
+	do {
+		iris_async_worker_t<> worker(2);
+		worker.record(&log);
+		worker.start();
+
+		std::atomic<size_t> remaining;
+		remaining.store(task_count, std::memory_order_relaxed);
+
+		for (size_t i = 0; i < task_count; i++) {
+			worker.queue([i, &order_mutex, &recorded_order, &remaining, &worker]() {
+				do {
+					std::lock_guard<std::mutex> guard(order_mutex);
+					recorded_order.emplace_back(i);
+				} while (false);
+
+				if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					worker.terminate();
+				}
+			});
+		}
+
+		worker.finalize();
+		while (!worker.join()) {}
+	} while (false);
+
+	IRIS_ASSERT(log.size() == task_count);
+
+	// replay single-threadedly in the recorded order
+	do {
+		iris_async_worker_t<> worker(0);
+		worker.append(std::thread()); // dummy placeholder, replay runs on this thread
+		worker.start();
+
+		std::vector<size_t> replayed_order;
+		for (size_t i = 0; i < task_count; i++) {
+			worker.queue([i, &replayed_order]() {
+				replayed_order.emplace_back(i);
+			});
+		}
+
+		bool replayed = worker.replay(log);
+		IRIS_ASSERT(replayed);
+		IRIS_ASSERT(replayed_order == recorded_order);
+
+		worker.terminate();
+		worker.finalize();
+		while (!worker.join()) {}
+	} while (false);
+}
+
+void shm_transport() {
+	static constexpr size_t item_count = 100000;
+	static constexpr size_t capacity = 256;
+
+	printf("[[ demo for iris dispatcher : shm_transport ]]\n");
+
+	// a heap region stands in for a shared memory mapping here; both sides
+	// would normally attach the same mapping at different addresses
+	std::vector<uint8_t> region(iris_shm_queue_t<size_t>::size_required(capacity));
+
+	iris_shm_queue_t<size_t> producer;
+	bool created = producer.create(region.data(), region.size(), capacity);
+	IRIS_ASSERT(created);
+
+	iris_shm_queue_t<size_t> consumer;
+	bool malformed_rejected = !consumer.attach(region.data(), 4); // malformed region rejected
+	IRIS_ASSERT(malformed_rejected);
+	bool attached = consumer.attach(region.data(), region.size());
+	IRIS_ASSERT(attached);
+
+	std::thread consumer_thread([&consumer]() {
+		size_t expected = 0;
+		size_t value = 0;
+		while (expected < item_count) {
+			consumer.pop_wait(value);
+			IRIS_ASSERT(value == expected);
+			expected++;
+		}
+	});
+
+	for (size_t i = 0; i < item_count; i++) {
+		while (!producer.push(i)) {
+			iris_thread_pause();
+		}
+	}
+
+	consumer_thread.join();
+	IRIS_ASSERT(consumer.empty());
+}
+
+void warp_allocator() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t message_count = 1000;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : warp_allocator ]]\n");
+
+	warp_t producer(worker);
+	warp_t consumer(worker);
+
+	struct message_t {
+		size_t payload[4];
+	};
+
+	iris_warp_allocator_t<message_t, warp_t> allocator(producer);
+	std::atomic<size_t> processed;
+	processed.store(0, std::memory_order_relaxed);
+
+	for (size_t i = 0; i < message_count; i++) {
+		producer.queue_routine_post([&allocator, &consumer, &producer, &worker, &processed, i]() {
+			// same-warp allocation, no atomics involved
+			message_t* message = allocator.allocate();
+			allocator.construct(message);
+			message->payload[0] = i;
+
+			consumer.queue_routine_post([&allocator, &producer, &worker, &processed, message]() {
+				IRIS_ASSERT(message->payload[0] < message_count);
+				allocator.destroy(message);
+				allocator.deallocate(message); // remote free through the inbox
+
+				if (processed.fetch_add(1, std::memory_order_acq_rel) + 1 == message_count) {
+					worker.terminate();
+				}
+			});
+		});
+	}
+
+	worker.finalize();
+	auto waiter = []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return true;
+	};
+
+	while (!worker.join() || !producer.join(waiter) || !consumer.join(waiter)) {}
+	IRIS_ASSERT(processed.load(std::memory_order_acquire) == message_count);
+}
+
+void epoch_iteration() {
+	static constexpr size_t item_count = 200000;
+
+	printf("[[ demo for iris dispatcher : epoch_iteration ]]\n");
+
+	// single writer, concurrent readers without copying data out
+	using epoch_queue_t = iris_queue_list_t<int, iris_default_block_allocator_t, true, iris_default_block_allocator_t, false, true>;
+	epoch_queue_t queue;
+
+	std::atomic<bool> writer_done;
+	writer_done.store(false, std::memory_order_relaxed);
+
+	std::thread writer([&queue, &writer_done]() {
+		for (size_t i = 0; i < item_count; i++) {
+			queue.push((int)(i & 0xffff));
+			if ((i & 3) == 0 && !queue.empty()) {
+				queue.pop(); // retires emptied nodes through the epoch domain
+			}
+		}
+
+		writer_done.store(true, std::memory_order_release);
+	});
+
+	std::thread reader([&queue, &writer_done]() {
+		size_t scans = 0;
+		while (!writer_done.load(std::memory_order_acquire)) {
+			size_t epoch = queue.reader_acquire();
+			size_t observed = 0;
+			queue.for_each_concurrent([&observed](const int& value) {
+				IRIS_ASSERT(value >= 0 && value <= 0xffff);
+				observed++;
+			});
+
+			queue.reader_release(epoch);
+			scans++;
+		}
+
+		printf("epoch reader completed %d scans\n", (int)scans);
+	});
+
+	writer.join();
+	reader.join();
+	queue.clear();
+}
+
+void deadline_lane() {
+	static constexpr size_t backlog_count = 2000;
+
+	iris_async_worker_t<> worker(1);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : deadline_lane ]]\n");
+
+	std::atomic<size_t> order;
+	order.store(0, std::memory_order_relaxed);
+	std::atomic<size_t> deadline_order;
+	deadline_order.store(~size_t(0), std::memory_order_relaxed);
+
+	for (size_t i = 0; i < backlog_count; i++) {
+		worker.queue([&order, &worker]() {
+			if (order.fetch_add(1, std::memory_order_acq_rel) + 1 == backlog_count + 1) {
+				worker.terminate();
+			}
+		});
+	}
+
+	// already at risk: must jump far ahead of the remaining backlog
+	size_t queued_at = order.load(std::memory_order_acquire);
+	worker.queue_deadline([&order, &deadline_order, &worker]() {
+		deadline_order.store(order.fetch_add(1, std::memory_order_acq_rel), std::memory_order_release);
+		if (deadline_order.load(std::memory_order_relaxed) + 1 == backlog_count + 1) {
+			worker.terminate();
+		}
+	}, iris_async_worker_t<>::get_now_milliseconds());
+
+	worker.finalize();
+	while (!worker.join()) {}
+
+	IRIS_ASSERT(order.load(std::memory_order_acquire) == backlog_count + 1);
+	printf("deadline task executed at position %d of %d, queued at %d\n", (int)deadline_order.load(std::memory_order_acquire), (int)backlog_count, (int)queued_at);
+	IRIS_ASSERT(deadline_order.load(std::memory_order_acquire) < queued_at + 64);
+
+	// an otherwise idle pool must fire a future deadline by itself once it
+	// becomes at risk, with no unrelated work arriving to wake anyone
+	do {
+		iris_async_worker_t<> idle_worker(2);
+		idle_worker.start();
+
+		std::atomic<long long> fired_after;
+		fired_after.store(-1, std::memory_order_relaxed);
+		auto armed_at = std::chrono::steady_clock::now();
+
+		idle_worker.queue_deadline([&fired_after, armed_at]() {
+			fired_after.store(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - armed_at).count(), std::memory_order_release);
+		}, iris_async_worker_t<>::get_now_milliseconds() + 50);
+
+		while (fired_after.load(std::memory_order_acquire) < 0) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+
+		printf("idle-pool deadline fired after %d ms\n", (int)fired_after.load(std::memory_order_relaxed));
+		IRIS_ASSERT(fired_after.load(std::memory_order_relaxed) < 2000); // not starved until shutdown
+
+		idle_worker.terminate();
+		idle_worker.finalize();
+		while (!idle_worker.join()) {}
+	} while (false);
+}
+
+void warp_pipeline() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t item_count = 500;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : warp_pipeline ]]\n");
+
+	warp_t stage_a(worker);
+	warp_t stage_b(worker);
+	warp_t stage_c(worker);
+
+	iris_pipeline_t<int, warp_t> pipeline;
+	pipeline.add_stage(&stage_a, [](int&& value) { return value + 1; }, 16);
+	pipeline.add_stage(&stage_b, [](int&& value) { return value * 2; }, 8);
+	pipeline.add_stage(&stage_c, [](int&& value) { return value; }, 8);
+
+	std::atomic<long long> sum;
+	sum.store(0, std::memory_order_relaxed);
+	std::atomic<size_t> delivered;
+	delivered.store(0, std::memory_order_relaxed);
+
+	pipeline.set_sink([&sum, &delivered, &worker](int&& value) {
+		sum.fetch_add(value, std::memory_order_relaxed);
+		if (delivered.fetch_add(1, std::memory_order_acq_rel) + 1 == item_count) {
+			worker.terminate();
+		}
+	});
+
+	for (size_t i = 0; i < item_count; i++) {
+		while (!pipeline.push((int)i)) {
+			iris_thread_pause(); // head stage saturated, backpressure
+		}
+	}
+
+	worker.finalize();
+	auto waiter = []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return true;
+	};
+
+	while (!worker.join() || !stage_a.join(waiter) || !stage_b.join(waiter) || !stage_c.join(waiter)) {}
+
+	long long expected = 0;
+	for (size_t i = 0; i < item_count; i++) {
+		expected += ((long long)i + 1) * 2;
+	}
+
+	IRIS_ASSERT(delivered.load(std::memory_order_acquire) == item_count);
+	IRIS_ASSERT(sum.load(std::memory_order_acquire) == expected);
+	IRIS_ASSERT(pipeline.get_in_flight() == 0);
+}
+
+void adaptive_warp() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t phase_count = 512;
+
+	iris_async_worker_t<> worker(thread_count);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : adaptive_warp ]]\n");
+
+	iris_adaptive_warp_t<iris_async_worker_t<>> warp(worker);
+	IRIS_ASSERT(warp.is_strand());
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	// steady-state phase on the strand mode
+	for (size_t i = 0; i < phase_count; i++) {
+		warp.queue_routine_post([&counter]() {
+			counter.fetch_add(1, std::memory_order_relaxed);
+		});
+	}
+
+	while (counter.load(std::memory_order_acquire) < phase_count) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	// quiescent: migrate to grid mode for the parallel-feed phase
+	while (!warp.try_switch(false)) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	IRIS_ASSERT(!warp.is_strand());
+	for (size_t i = 0; i < phase_count; i++) {
+		worker.queue([&warp, &counter, &worker]() {
+			warp.queue_routine_post([&counter, &worker]() {
+				if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == phase_count * 2) {
+					worker.terminate();
+				}
+			});
+		});
+	}
+
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == phase_count * 2);
+
+	auto strand_stats = warp.get_strand_warp().get_stats();
+	auto grid_stats = warp.get_grid_warp().get_stats();
+	IRIS_ASSERT(strand_stats.executed_count >= phase_count);
+	IRIS_ASSERT(grid_stats.executed_count >= 1);
+}
+
+void auto_scaling() {
+	static constexpr size_t max_threads = 4;
+
+	iris_async_worker_t<> worker(max_threads);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : auto_scaling ]]\n");
+
+	iris_async_scaler_t<iris_async_worker_t<>> scaler(worker, 1, max_threads, 5);
+	IRIS_ASSERT(scaler.get_active_count() == 1); // starts at the minimum
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+	static constexpr size_t burst_count = 5000;
+
+	for (size_t i = 0; i < burst_count; i++) {
+		worker.queue([&counter]() {
+			counter.fetch_add(1, std::memory_order_relaxed);
+		});
+	}
+
+	// sustained demand unparks threads
+	size_t grown = 0;
+	while (counter.load(std::memory_order_acquire) < burst_count) {
+		scaler.update();
+		grown = std::max(grown, scaler.get_active_count());
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	// idle timeout parks them again
+	for (size_t i = 0; i < 100 && scaler.get_active_count() > 1; i++) {
+		scaler.update();
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+
+	printf("auto scaler grew to %d threads\n", (int)grown);
+	IRIS_ASSERT(scaler.get_active_count() == 1);
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join()) {}
+}
+
+void inline_recursion() {
+	static constexpr size_t thread_count = 2;
+	static constexpr size_t recursion_count = 100000;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : inline_recursion ]]\n");
+
+	warp_t warp(worker);
+	warp.set_inline_depth_limit(8);
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	// deeply nested queue_routine: inline up to the depth limit, then posted,
+	// so the stack stays bounded no matter the recursion count
+	std::function<void()> recurse;
+	recurse = [&warp, &recurse, &counter, &worker]() {
+		if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == recursion_count) {
+			worker.terminate();
+		} else {
+			warp.queue_routine(recurse);
+		}
+	};
+
+	warp.queue_routine_post(recurse);
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == recursion_count);
+}
+
+// keeps the pretend work of sliced_job_t from being optimized away
+static std::atomic<size_t> sliced_work_sink;
+
+// long routine split across time slices, re-queueing its remaining work
+struct sliced_job_t {
+	void operator () () {
+		while (remaining != 0) {
+			// one chunk of pretend work
+			size_t sink = 0;
+			for (size_t i = 0; i < 2000; i++) {
+				sink += i;
+			}
+
+			sliced_work_sink.store(sink, std::memory_order_relaxed);
+			remaining--;
+
+			if (remaining != 0 && warp->yield_check()) {
+				(*slices)++;
+				warp->requeue_routine(sliced_job_t(*this));
+				return;
+			}
+		}
+
+		worker->terminate();
+	}
+
+	iris_warp_t<iris_async_worker_t<>>* warp;
+	iris_async_worker_t<>* worker;
+	size_t remaining;
+	size_t* slices;
+};
+
+void time_sliced() {
+	static constexpr size_t thread_count = 2;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : time_sliced ]]\n");
+
+	warp_t warp(worker);
+	warp.set_time_slice(100); // 100us budget per pass
+
+	size_t slices = 0;
+	warp.queue_routine_post(sliced_job_t{ &warp, &worker, 2000, &slices });
+
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	printf("long routine completed in %d slices\n", (int)(slices + 1));
+	IRIS_ASSERT(slices > 0); // the slice budget forced at least one requeue
+}
+
+void task_groups() {
+	static constexpr size_t thread_count = 2;
+	static constexpr size_t speculative_count = 20000;
+
+	iris_async_worker_t<> worker(thread_count);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : task_groups ]]\n");
+
+	iris_task_group_t<iris_async_worker_t<>> group;
+	std::atomic<size_t> executed;
+	executed.store(0, std::memory_order_relaxed);
+
+	for (size_t i = 0; i < speculative_count; i++) {
+		group.queue(worker, [&executed]() {
+			executed.fetch_add(1, std::memory_order_relaxed);
+			std::this_thread::sleep_for(std::chrono::microseconds(1));
+		});
+	}
+
+	// teardown: drop everything not yet started instead of executing it all
+	group.cancel();
+	group.join();
+	IRIS_ASSERT(group.get_pending_count() == 0);
+
+	size_t ran = executed.load(std::memory_order_acquire);
+	printf("task group executed %d of %d speculative tasks before cancel\n", (int)ran, (int)speculative_count);
+	IRIS_ASSERT(ran < speculative_count); // the bulk was dropped
+
+	// a fresh group drains normally and fires the drain callback
+	std::atomic<bool> drained;
+	drained.store(false, std::memory_order_relaxed);
+	iris_task_group_t<iris_async_worker_t<>> normal_group;
+	std::atomic<size_t> completed;
+	completed.store(0, std::memory_order_relaxed);
+
+	for (size_t i = 0; i < 100; i++) {
+		normal_group.queue(worker, [&completed]() {
+			completed.fetch_add(1, std::memory_order_relaxed);
+		});
+	}
+
+	if (!normal_group.notify_on_drain([&drained]() { drained.store(true, std::memory_order_release); })) {
+		drained.store(true, std::memory_order_release);
+	}
+
+	normal_group.join();
+	while (!drained.load(std::memory_order_acquire)) {
+		iris_thread_pause();
+	}
+
+	IRIS_ASSERT(completed.load(std::memory_order_acquire) == 100);
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join()) {}
+}
+
+void federation() {
+	static constexpr size_t thread_count = 2;
+	static constexpr uint64_t edge_id = 0x1001;
+	static constexpr uint64_t early_edge_id = 0x1002;
+
+	printf("[[ demo for iris dispatcher : federation ]]\n");
+
+	// two dispatchers stand in for two hosts, the transport lambdas are the wire
+	iris_async_worker_t<> worker_a(thread_count);
+	iris_async_worker_t<> worker_b(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	using dispatcher_t = iris_dispatcher_t<warp_t>;
+	worker_a.start();
+	worker_b.start();
+
+	dispatcher_t dispatcher_a(worker_a);
+	dispatcher_t dispatcher_b(worker_b);
+
+	iris_dispatcher_federation_t<dispatcher_t> federation_a(dispatcher_a);
+	iris_dispatcher_federation_t<dispatcher_t> federation_b(dispatcher_b);
+	federation_a.set_transport([&federation_b](uint64_t id) { federation_b.deliver(id); });
+	federation_b.set_transport([&federation_a](uint64_t id) { federation_a.deliver(id); });
+
+	std::atomic<int> stage;
+	stage.store(0, std::memory_order_relaxed);
+
+	// node a: producer whose completion is exported
+	auto produced = dispatcher_a.allocate(nullptr, [&stage]() {
+		IRIS_ASSERT(stage.fetch_add(1, std::memory_order_acq_rel) == 0);
+	});
+	federation_a.export_completion(produced, edge_id);
+
+	// node b: consumer ordered after the remote completion
+	auto remote = federation_b.make_remote_dependency(edge_id);
+	auto consumer = dispatcher_b.allocate(nullptr, [&stage]() {
+		IRIS_ASSERT(stage.fetch_add(1, std::memory_order_acq_rel) == 1); // after the producer
+	});
+	dispatcher_b.order(remote, consumer);
+	dispatcher_b.dispatch(remote);
+	dispatcher_b.dispatch(consumer);
+
+	dispatcher_a.dispatch(produced);
+	dispatcher_a.wait_for_completion();
+	dispatcher_b.wait_for_completion();
+	IRIS_ASSERT(stage.load(std::memory_order_acquire) == 2);
+
+	// a notification racing ahead of the graph build is kept
+	federation_a.deliver(early_edge_id);
+	auto early = federation_a.make_remote_dependency(early_edge_id);
+	auto after_early = dispatcher_a.allocate(nullptr, [&stage]() {
+		stage.fetch_add(1, std::memory_order_acq_rel);
+	});
+	dispatcher_a.order(early, after_early);
+	dispatcher_a.dispatch(early);
+	dispatcher_a.dispatch(after_early);
+	dispatcher_a.wait_for_completion();
+	IRIS_ASSERT(stage.load(std::memory_order_acquire) == 3);
+
+	worker_a.terminate();
+	worker_b.terminate();
+	worker_a.finalize();
+	worker_b.finalize();
+	while (!worker_a.join() || !worker_b.join()) {}
+}
+
+void resume_coalescing() {
+	static constexpr size_t thread_count = 2;
+	static constexpr size_t cycle_count = 500;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : resume_coalescing ]]\n");
+
+	warp_t warp(worker);
+	std::atomic<size_t> executed;
+	executed.store(0, std::memory_order_relaxed);
+
+	// interleaved suspend/post/resume storm, the door/trigger pattern
+	for (size_t i = 0; i < cycle_count; i++) {
+		warp.suspend();
+		warp.queue_routine_post([&executed, &worker]() {
+			if (executed.fetch_add(1, std::memory_order_acq_rel) + 1 == cycle_count) {
+				worker.terminate();
+			}
+		});
+
+		warp.resume();
+	}
+
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(executed.load(std::memory_order_acquire) == cycle_count);
+	warp_t::stats_t stats = warp.get_stats();
+	printf("resume coalescing: %d cycles served by %d flushes\n", (int)cycle_count, (int)stats.flush_count);
+	IRIS_ASSERT(stats.flush_count <= cycle_count * 2); // no storm of redundant submissions
+}
+
+// the one concrete routine type of a fixed-function warp: the drain loop
+// calls operator() directly, no type erasure, fully inlinable
+struct accumulate_routine_t {
+	void operator () () noexcept {
+		*sum += value;
+	}
+
+	size_t* sum;
+	size_t value;
+};
+
+void static_warp() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t routine_count = 100000;
+
+	using worker_t = iris_async_worker_t<>;
+	using warp_t = iris_static_warp_t<worker_t, accumulate_routine_t>;
+
+	worker_t worker(thread_count);
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : static_warp ]]\n");
+
+	warp_t warp(worker);
+	size_t sum = 0; // warp-serialized, no atomics needed
+
+	std::atomic<size_t> queued;
+	queued.store(0, std::memory_order_relaxed);
+	worker.queue([&worker, &warp, &sum, &queued]() {
+		for (size_t i = 0; i < routine_count; i++) {
+			warp.queue_routine_post(accumulate_routine_t{ &sum, i });
+		}
+
+		queued.store(1, std::memory_order_release);
+	});
+
+	while (queued.load(std::memory_order_acquire) == 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+
+	IRIS_ASSERT(sum == routine_count * (routine_count - 1) / 2);
+}
+
+void shared_join() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t warp_count = 4;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : shared_join ]]\n");
+
+	std::vector<warp_t> warps;
+	warps.reserve(warp_count);
+	for (size_t i = 0; i < warp_count; i++) {
+		warps.emplace_back(worker);
+	}
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+	for (size_t i = 0; i < warp_count; i++) {
+		warps[i].queue_routine_post([&worker, &counter]() {
+			if (counter.fetch_add(1, std::memory_order_acq_rel) + 1 == warp_count) {
+				worker.terminate();
+			}
+		});
+	}
+
+	// read phase: multiple shared joins coexist and warps keep running
+	bool first_shared = warp_t::join_shared(&warps[0], &warps[0] + warp_count);
+	IRIS_ASSERT(first_shared);
+	bool second_shared = warp_t::join_shared(&warps[0], &warps[0] + warp_count);
+	IRIS_ASSERT(second_shared);
+
+	// a writer is held off while readers are active
+	bool writer_blocked = !warp_t::join_exclusive(&warps[0], &warps[0] + warp_count, []() { return false; });
+	IRIS_ASSERT(writer_blocked);
+
+	warp_t::leave_shared(&warps[0], &warps[0] + warp_count);
+	warp_t::leave_shared(&warps[0], &warps[0] + warp_count);
+
+	worker.finalize();
+	while (!worker.join() || !warp_t::join_exclusive(&warps[0], &warps[0] + warp_count, []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return false;
+	})) {}
+
+	// the writer already released here, so readers pass again
+	bool reader_after_writer = warp_t::join_shared(&warps[0], &warps[0] + warp_count);
+	IRIS_ASSERT(reader_after_writer);
+	warp_t::leave_shared(&warps[0], &warps[0] + warp_count);
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == warp_count);
+}
+
 void stack_op() {
 	static constexpr size_t thread_count = 4;
 	static constexpr size_t warp_count = 8;
@@ -123,14 +1128,72 @@ void not_pow_two() {
 	iris_queue_list_t<pos_t> data;
 	data.push(pos_t(1, 2, 3));
 	data.push(pos_t(1, 2, 3));
+
+	// in-place construction from constructor arguments, no intermediate moves
+	for (size_t i = 0; i < 1000; i++) {
+		data.emplace(4.0f, 5.0f, 6.0f);
+	}
+
 	pos_t d = data.top();
 	data.pop();
 	d.x = 2;
+
+	while (!data.empty()) {
+		data.pop();
+	}
 }
 
 void framed_data() {
 	printf("[[ demo for iris dispatcher : framed_data ]]\n");
 
+	do {
+		// bulk span push/pop across node boundaries
+		iris_queue_list_t<int> stream;
+		std::vector<int> source(1000);
+		for (size_t i = 0; i < source.size(); i++) {
+			source[i] = (int)i;
+		}
+
+		stream.push_n(source.data(), source.size());
+		IRIS_ASSERT(stream.size() == source.size());
+
+		size_t run_length = 0;
+		const int* run = stream.peek(run_length);
+		IRIS_ASSERT(run != nullptr && run_length != 0 && run[0] == 0);
+
+		std::vector<int> target(source.size());
+		size_t popped = stream.pop_n(target.data(), target.size());
+		IRIS_ASSERT(popped == source.size());
+		IRIS_ASSERT(target == source);
+		IRIS_ASSERT(stream.empty());
+	} while (false);
+
+	do {
+		// counted mode: size() is o(1) from a maintained counter
+		iris_queue_list_t<int, iris_default_block_allocator_t, true, iris_default_block_allocator_t, true> counted;
+		counted.reserve(700); // burst preallocation, no allocator hits below
+		counted.set_growth_factor(2);
+		for (int i = 0; i < 700; i++) {
+			counted.push(i);
+		}
+
+		IRIS_ASSERT(counted.size() == 700);
+		counted.pop(100);
+		IRIS_ASSERT(counted.size() == 600);
+
+		int sink[50];
+		counted.pop(sink, sink + 50);
+		IRIS_ASSERT(counted.size() == 550);
+
+		int source[32] = { 0 };
+		counted.push_n(source, 32);
+		counted.emplace(1);
+		IRIS_ASSERT(counted.size() == 583);
+
+		counted.clear();
+		IRIS_ASSERT(counted.size() == 0);
+	} while (false);
+
 	iris_queue_list_t<int> data;
 
 	int temp[4] = { 5, 8, 13, 21 };
@@ -537,6 +1600,223 @@ void graph_dispatch() {
 	})) {}
 }
 
+void graph_cancellation() {
+	static constexpr size_t thread_count = 4;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	using dispatcher_t = iris_dispatcher_t<warp_t>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : graph_cancellation ]]\n");
+
+	dispatcher_t dispatcher(worker, [&worker](dispatcher_t& dispatcher, bool success) {
+		worker.terminate();
+	});
+
+	iris_cancellation_token_t token;
+	std::atomic<size_t> executed;
+	executed.store(0, std::memory_order_relaxed);
+
+	auto a = dispatcher.allocate(nullptr, [&executed, &token]() {
+		executed.fetch_add(1, std::memory_order_relaxed);
+		token.cancel(); // client disconnected mid-chain
+	});
+
+	auto b = dispatcher.allocate(nullptr, [&executed]() {
+		executed.fetch_add(1, std::memory_order_relaxed);
+		IRIS_ASSERT(false); // must be skipped
+	});
+	dispatcher.set_cancellation(b, &token);
+
+	auto c = dispatcher.allocate(nullptr, [&executed]() {
+		executed.fetch_add(1, std::memory_order_relaxed); // untagged, still runs
+	});
+
+	dispatcher.order(a, b);
+	dispatcher.order(b, c);
+	dispatcher.dispatch(a);
+	dispatcher.dispatch(b);
+	dispatcher.dispatch(c);
+
+	// external thread blocks on the completion handle instead of spinning
+	dispatcher.wait_for_completion();
+	IRIS_ASSERT(dispatcher.get_pending_count() == 0);
+	IRIS_ASSERT(dispatcher.wait_for_completion(std::chrono::milliseconds(1)));
+
+	worker.finalize();
+	while (!worker.join()) {}
+
+	IRIS_ASSERT(executed.load(std::memory_order_acquire) == 2);
+}
+
+void graph_fusion() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t chain_length = 32;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	using dispatcher_t = iris_dispatcher_t<warp_t>;
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : graph_fusion ]]\n");
+
+	dispatcher_t dispatcher(worker);
+	warp_t warp(worker);
+
+	// a plain linear chain fuses: strictly increasing order on one warp
+	std::atomic<size_t> sequence;
+	sequence.store(0, std::memory_order_relaxed);
+
+	dispatcher_t::routine_t* nodes[chain_length];
+	for (size_t i = 0; i < chain_length; i++) {
+		nodes[i] = dispatcher.allocate(&warp, [&sequence, i]() {
+			IRIS_ASSERT(sequence.fetch_add(1, std::memory_order_acq_rel) == i);
+		});
+	}
+
+	for (size_t i = 1; i < chain_length; i++) {
+		dispatcher.order(nodes[i - 1], nodes[i]);
+	}
+
+	for (size_t i = 0; i < chain_length; i++) {
+		dispatcher.dispatch(nodes[i]);
+	}
+
+	dispatcher.wait_for_completion();
+	IRIS_ASSERT(sequence.load(std::memory_order_acquire) == chain_length);
+
+	// a routine that suspends its own warp gates the successor until the
+	// asynchronous resume, fusion must not run it inline
+	std::atomic<bool> resumed;
+	resumed.store(false, std::memory_order_relaxed);
+	std::atomic<int> stage;
+	stage.store(0, std::memory_order_relaxed);
+
+	auto gate = dispatcher.allocate(&warp, [&worker, &warp, &resumed, &stage]() {
+		stage.store(1, std::memory_order_release);
+		warp.suspend();
+		worker.queue([&warp, &resumed]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			resumed.store(true, std::memory_order_release);
+			warp.resume();
+		});
+	});
+
+	auto gated = dispatcher.allocate(&warp, [&resumed, &stage]() {
+		IRIS_ASSERT(resumed.load(std::memory_order_acquire)); // only after the resume
+		stage.store(2, std::memory_order_release);
+	});
+
+	dispatcher.order(gate, gated);
+	dispatcher.dispatch(gate);
+	dispatcher.dispatch(gated);
+	dispatcher.wait_for_completion();
+	IRIS_ASSERT(stage.load(std::memory_order_acquire) == 2);
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join() || !warp.join([] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); return true; })) {}
+}
+
+void graph_arena() {
+	static constexpr size_t thread_count = 4;
+	static constexpr size_t frame_count = 16;
+	static constexpr size_t chain_count = 64;
+
+	iris_async_worker_t<> worker(thread_count);
+	using warp_t = iris_warp_t<iris_async_worker_t<>>;
+	using dispatcher_t = iris_dispatcher_t<warp_t, true>; // arena mode
+	worker.start();
+
+	printf("[[ demo for iris dispatcher : graph_arena ]]\n");
+
+	std::promise<void>* frame_done = nullptr;
+	dispatcher_t dispatcher(worker, [&frame_done](dispatcher_t& dispatcher, bool success) {
+		frame_done->set_value();
+	});
+
+	std::atomic<size_t> counter;
+	counter.store(0, std::memory_order_relaxed);
+
+	// rebuild a similar graph every frame, all nodes come from the arena
+	// and are recycled at once by reset()
+	for (size_t frame = 0; frame < frame_count; frame++) {
+		std::promise<void> done;
+		frame_done = &done;
+
+		std::vector<std::pair<dispatcher_t::routine_t*, dispatcher_t::routine_t*>> edges;
+		edges.reserve(chain_count * 2);
+
+		auto sink = dispatcher.allocate(nullptr, [&counter]() {
+			counter.fetch_add(1, std::memory_order_acq_rel);
+		});
+
+		for (size_t i = 0; i < chain_count; i++) {
+			auto a = dispatcher.allocate(nullptr, [&counter]() {
+				counter.fetch_add(1, std::memory_order_acq_rel);
+			});
+
+			auto b = dispatcher.allocate(nullptr, [&counter]() {
+				counter.fetch_add(1, std::memory_order_acq_rel);
+			});
+
+			edges.emplace_back(a, b);
+			edges.emplace_back(b, sink);
+			dispatcher.order_batch(edges.end() - 2, edges.end());
+
+			dispatcher.dispatch(a);
+			dispatcher.dispatch(b);
+		}
+
+		dispatcher.dispatch(sink);
+		done.get_future().wait();
+		dispatcher.reset();
+	}
+
+	// compiled wavefront replay of a stable graph shape
+	do {
+		iris_wavefront_graph_t<iris_async_worker_t<>> graph;
+		std::atomic<size_t> wave_counter;
+		wave_counter.store(0, std::memory_order_relaxed);
+
+		size_t a = graph.add([&wave_counter]() { IRIS_ASSERT(wave_counter.load(std::memory_order_acquire) == 0); });
+		size_t b = graph.add([&wave_counter]() { wave_counter.fetch_add(1, std::memory_order_acq_rel); });
+		size_t c = graph.add([&wave_counter]() { wave_counter.fetch_add(1, std::memory_order_acq_rel); });
+		size_t d = graph.add([&wave_counter]() { IRIS_ASSERT(wave_counter.load(std::memory_order_acquire) == 2); });
+
+		graph.order(a, b);
+		graph.order(a, c);
+		graph.order(b, d);
+		graph.order(c, d);
+		bool compiled = graph.compile();
+		IRIS_ASSERT(compiled);
+		IRIS_ASSERT(graph.get_wave_count() == 3);
+
+		for (size_t frame = 0; frame < 8; frame++) {
+			std::promise<void> frame_finished;
+			wave_counter.store(0, std::memory_order_release);
+			graph.run(worker, [&frame_finished]() { frame_finished.set_value(); });
+			frame_finished.get_future().wait();
+		}
+
+		// a cycle is rejected at compile time
+		iris_wavefront_graph_t<iris_async_worker_t<>> cyclic;
+		size_t x = cyclic.add([]() {});
+		size_t y = cyclic.add([]() {});
+		cyclic.order(x, y);
+		cyclic.order(y, x);
+		bool cycle_rejected = !cyclic.compile();
+		IRIS_ASSERT(cycle_rejected);
+	} while (false);
+
+	worker.terminate();
+	worker.finalize();
+	while (!worker.join()) {}
+
+	IRIS_ASSERT(counter.load(std::memory_order_acquire) == frame_count * (chain_count * 2 + 1));
+}
+
 void graph_dispatch_exception() {
 	static constexpr size_t thread_count = 8;
 	static constexpr size_t warp_count = 16;
@@ -601,6 +1881,8 @@ void acquire_release() {
 	worker.start();
 
 	warp_t main_warp(worker, 0);
+	main_warp.set_execute_quota(16); // fairness: yield after 16 tasks per pass
+	main_warp.set_flush_escalation(64, 0); // escalate when backed up
 	std::atomic<int> counter;
 	counter.store(0, std::memory_order_relaxed);
 
@@ -630,5 +1912,13 @@ void acquire_release() {
 		std::this_thread::sleep_for(std::chrono::milliseconds(50));
 		return true;
 	});
+
+	warp_t::stats_t stats = main_warp.get_stats();
+	IRIS_ASSERT(stats.executed_count >= 2000);
+	IRIS_ASSERT(stats.max_batch_count != 0 && stats.flush_count != 0);
+	IRIS_ASSERT(stats.max_batch_count <= 16); // quota bounds every pass
+	printf("main warp stats: executed %d, max batch %d, suspend %d, resume %d, preempt failed %d, flush %d\n",
+		(int)stats.executed_count, (int)stats.max_batch_count, (int)stats.suspend_count,
+		(int)stats.resume_count, (int)stats.preempt_failed_count, (int)stats.flush_count);
 }
 
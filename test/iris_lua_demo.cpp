@@ -1,4 +1,5 @@
 #include "../src/iris_lua.h"
+#include "../src/iris_lua_buffer.h"
 #include "../src/iris_common.inl"
 #include <map>
 #include <chrono>
@@ -54,10 +55,19 @@ struct iris::iris_lua_traits_t<vector3> : std::true_type {
 	}
 };
 
+static void zero_alloc_probe(int, double, const char*) {}
+static std::string allocating_probe(std::string s) { return s; }
+
 struct example_base_t {
 	static void lua_registar(lua_t lua) {
+		// audit hot bindings at compile time: these must not allocate per call
+		static_assert(lua_t::is_zero_alloc<&example_base_t::base_bind>, "binding should be allocation-free");
+		static_assert(lua_t::is_zero_alloc<&zero_alloc_probe>, "binding should be allocation-free");
+		static_assert(!lua_t::is_zero_alloc<&allocating_probe>, "std::string marshaling allocates");
+
 		lua.set_current<&example_base_t::base_value>("base_value");
 		lua.set_current<&example_base_t::base_func>("base_func");
+		lua.set_current_unchecked<&example_base_t::base_func>("base_func_fast"); // trusted fast path
 		lua.set_current<&example_base_t::base_bind_static>("base_bind_static", 1.0);
 		lua.set_current<&example_base_t::base_bind>("base_bind", 1.0);
 	}
@@ -479,6 +489,24 @@ end\n\
 	auto* g = target.native_get_variable<example_t*>(-1);
 	lua.native_pop_variable(3);
 
+#if USE_LUA_COROUTINE
+	// cross-warp transfer: deep-copy a table into `target` from a routine on warp2
+	do {
+		std::atomic<bool> transferred;
+		transferred.store(false, std::memory_order_relaxed);
+
+		lua.transfer<true>(target, warp2, lua.make_table([](lua_t t) { t.set_current("key", 42); }), [&transferred](lua_t target_state, lua_t::ref_t&& result) {
+			IRIS_ASSERT(*result.get<int>(target_state, "key") == 42);
+			target_state.deref(std::move(result));
+			transferred.store(true, std::memory_order_release);
+		});
+
+		while (!transferred.load(std::memory_order_acquire)) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	} while (false);
+#endif
+
 	int result = target.native_call(std::move(test), 3).value();
 	IRIS_ASSERT(existing_object.value == 3333);
 	int ret_val = target.native_get_variable<int>(-1);
@@ -592,6 +620,53 @@ end\n\
 	IRIS_ASSERT(!lua.load("err"));
 	printf("Error message: %s\n", lua.load("err").message.c_str());
 
+	// interned field keys and bulk field fetches
+	do {
+		auto fields = lua.make_table([](lua_t t) {
+			t.set_current("health", 83);
+			t.set_current("speed", 2.5);
+		});
+
+		lua_t::ref_t key_health = lua.intern("health");
+		lua_t::ref_t key_speed = lua.intern("speed");
+
+		for (size_t i = 0; i < 100; i++) {
+			IRIS_ASSERT(*fields.get<int>(lua, key_health) == 83); // cached ref, no string re-push
+		}
+
+		auto bulk = lua.get_fields<int, double>(fields, key_health, key_speed);
+		IRIS_ASSERT(std::get<0>(bulk) == 83);
+		IRIS_ASSERT(std::get<1>(bulk) == 2.5);
+
+		lua.deref(std::move(key_health));
+		lua.deref(std::move(key_speed));
+		lua.deref(std::move(fields));
+	} while (false);
+
+	// trusted unchecked registration skips the per-call validation pass
+	lua.set_global_unchecked<&zero_alloc_probe>("fast_probe");
+	lua.call<void>(lua.load("\n\
+		fast_probe(1, 2.5, 'x')\n\
+		local e = example_t.new()\n\
+		e:base_func_fast()\n").value());
+
+	// zero-copy buffer marshaling: the bound function receives a view aliasing
+	// the lua-owned string, and returns bytes back as a lua string
+	lua.set_global("echo_bytes", [](iris_bytes_t bytes) {
+		IRIS_ASSERT(bytes.is_view_storage());
+		iris_bytes_t copy;
+		copy.assign(bytes.get_data(), bytes.get_size());
+		return copy;
+	});
+
+	lua.call<void>(lua.load("\n\
+		local echoed = echo_bytes('binary\\0payload')\n\
+		assert(#echoed == 14)\n\
+		assert(echoed == 'binary\\0payload')\n").value());
+
+	// cooperative gc: bounded incremental steps instead of a full collection
+	while (!lua.gc_step(16, 200)) {}
+
 #if USE_LUA_COROUTINE
 
 #if LUA_VERSION_NUM <= 501
@@ -626,6 +701,9 @@ end\n\
 		coroutine.resume(coro)\n").value());
 #endif
 
+	// pace another gc cycle from the warp scheduler
+	lua.queue_gc(warp, 16, 200);
+
 	warp.yield();
 	worker.finalize();
 
@@ -0,0 +1,216 @@
+#define IRIS_ENABLE_STATS 1
+#include "../src/iris_coroutine.h"
+#include "../src/iris_system.h"
+#include "../src/iris_common.inl"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+using namespace iris;
+
+// configurable soak/load harness composing worker + warps + systems into a
+// production-shaped workload, for qualifying iris upgrades before rollout.
+//
+// usage: iris_soak [threads] [warps] [entities] [seconds] [mix]
+//   mix is any combination of: s(trand) g(rid) p(arallel) c(oroutine),
+//   default "sgpc" runs everything.
+//
+// end-of-run report: per-mix routine throughput, worker p50/p99 task latency
+// from the built-in histograms, entity iteration rate, allocator high-water
+// and peak rss, emitted as machine-readable csv lines.
+
+using worker_t = iris_async_worker_t<>;
+using strand_warp_t = iris_warp_t<worker_t, true>;
+using grid_warp_t = iris_warp_t<worker_t, false>;
+using coroutine_t = iris_coroutine_t<>;
+
+struct soak_config_t {
+	size_t thread_count = std::max((size_t)std::thread::hardware_concurrency(), (size_t)2);
+	size_t warp_count = 8;
+	size_t entity_count = 50000;
+	size_t duration_seconds = 2;
+	bool run_strand = true;
+	bool run_grid = true;
+	bool run_parallel = true;
+	bool run_coroutine = true;
+};
+
+static size_t peak_rss_kb() {
+#if !defined(_WIN32)
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return (size_t)usage.ru_maxrss;
+#else
+	return 0;
+#endif
+}
+
+struct position_t {
+	float values[4];
+};
+
+template <typename element_t>
+using soak_allocator_t = iris_block_allocator_t<element_t>;
+
+static std::atomic<size_t> strand_routines;
+static std::atomic<size_t> grid_routines;
+static std::atomic<size_t> parallel_routines;
+static std::atomic<size_t> coroutine_awaits;
+static std::atomic<bool> soak_running;
+
+// callback-style load: every completed routine re-queues itself, ordered
+// through its warp, until the clock runs out
+template <typename target_warp_t>
+static void pump_warp(target_warp_t& warp, std::atomic<size_t>& counter) {
+	warp.queue_routine_post([&warp, &counter]() {
+		counter.fetch_add(1, std::memory_order_relaxed);
+		if (soak_running.load(std::memory_order_acquire)) {
+			pump_warp(warp, counter);
+		}
+	});
+}
+
+// parallel (read-style) load over a warp
+static void pump_parallel(strand_warp_t& warp, std::atomic<size_t>& counter) {
+	warp.queue_routine_parallel_post([&warp, &counter]() {
+		counter.fetch_add(1, std::memory_order_relaxed);
+		if (soak_running.load(std::memory_order_acquire)) {
+			pump_parallel(warp, counter);
+		}
+	});
+}
+
+// coroutine-style load: switch between two warps per iteration
+static coroutine_t pump_coroutine(strand_warp_t* a, strand_warp_t* b, std::atomic<size_t>& counter, std::atomic<size_t>& live) {
+	while (soak_running.load(std::memory_order_acquire)) {
+		co_await iris_switch(a);
+		co_await iris_switch(b);
+		counter.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	live.fetch_sub(1, std::memory_order_release);
+}
+
+int main(int argc, char* argv[]) {
+	soak_config_t config;
+	if (argc > 1) config.thread_count = std::max(atoi(argv[1]), 1);
+	if (argc > 2) config.warp_count = std::max(atoi(argv[2]), 2);
+	if (argc > 3) config.entity_count = std::max(atoi(argv[3]), 1);
+	if (argc > 4) config.duration_seconds = std::max(atoi(argv[4]), 1);
+	if (argc > 5) {
+		config.run_strand = strchr(argv[5], 's') != nullptr;
+		config.run_grid = strchr(argv[5], 'g') != nullptr;
+		config.run_parallel = strchr(argv[5], 'p') != nullptr;
+		config.run_coroutine = strchr(argv[5], 'c') != nullptr;
+	}
+
+	printf("soak: %d threads, %d warps, %d entities, %d seconds\n",
+		(int)config.thread_count, (int)config.warp_count, (int)config.entity_count, (int)config.duration_seconds);
+
+	worker_t worker(config.thread_count);
+	worker.start();
+
+	std::vector<strand_warp_t> strand_warps;
+	std::vector<strand_warp_t> coroutine_warps; // the saturated pump warps would starve switches
+	std::vector<strand_warp_t> parallel_warps; // suspend-heavy parallel load gets its own set
+	std::vector<grid_warp_t> grid_warps;
+	strand_warps.reserve(config.warp_count);
+	coroutine_warps.reserve(config.warp_count);
+	parallel_warps.reserve(config.warp_count);
+	grid_warps.reserve(config.warp_count);
+	for (size_t i = 0; i < config.warp_count; i++) {
+		strand_warps.emplace_back(worker, i % std::max(config.thread_count, (size_t)1));
+		coroutine_warps.emplace_back(worker);
+		parallel_warps.emplace_back(worker);
+		grid_warps.emplace_back(worker);
+	}
+
+	// entity load: iterated every "frame" alongside the routine churn
+	iris_system_t<uint32_t, soak_allocator_t, std::allocator, position_t, uint64_t> world;
+	for (size_t i = 0; i < config.entity_count; i++) {
+		world.insert(iris_verify_cast<uint32_t>(i), position_t{ { 0, 0, 0, 1 } }, (uint64_t)i);
+	}
+
+	strand_routines.store(0, std::memory_order_relaxed);
+	grid_routines.store(0, std::memory_order_relaxed);
+	parallel_routines.store(0, std::memory_order_relaxed);
+	coroutine_awaits.store(0, std::memory_order_relaxed);
+	soak_running.store(true, std::memory_order_release);
+
+	std::atomic<size_t> live_coroutines;
+	live_coroutines.store(0, std::memory_order_relaxed);
+
+	for (size_t i = 0; i < config.warp_count; i++) {
+		if (config.run_strand) {
+			pump_warp(strand_warps[i], strand_routines);
+		}
+
+		if (config.run_grid) {
+			pump_warp(grid_warps[i], grid_routines);
+		}
+
+		if (config.run_parallel) {
+			pump_parallel(parallel_warps[i], parallel_routines);
+		}
+
+		if (config.run_coroutine) {
+			live_coroutines.fetch_add(1, std::memory_order_relaxed);
+			pump_coroutine(&coroutine_warps[i], &coroutine_warps[(i + 1) % config.warp_count], coroutine_awaits, live_coroutines).run();
+		}
+	}
+
+	// frame loop on the main thread: iterate the world while the pumps churn
+	auto start = std::chrono::steady_clock::now();
+	size_t frames = 0;
+	size_t iterated = 0;
+	while (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count() < (long long)config.duration_seconds) {
+		world.iterate<position_t>([&iterated](position_t& position) {
+			position.values[0] += 1.0f;
+			iterated++;
+		});
+
+		frames++;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	soak_running.store(false, std::memory_order_release);
+	while (live_coroutines.load(std::memory_order_acquire) != 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	worker.terminate();
+	worker.finalize();
+	auto waiter = [] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return true;
+	};
+
+	while (!worker.join() ||
+		!strand_warp_t::join(strand_warps.begin(), strand_warps.end(), waiter) ||
+		!strand_warp_t::join(coroutine_warps.begin(), coroutine_warps.end(), waiter) ||
+		!strand_warp_t::join(parallel_warps.begin(), parallel_warps.end(), waiter) ||
+		!grid_warp_t::join(grid_warps.begin(), grid_warps.end(), waiter)) {}
+
+	double seconds = (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0;
+
+	// machine-readable report
+	printf("metric,value,unit\n");
+	printf("strand_routines_per_sec,%.0f,1/s\n", (double)strand_routines.load() / seconds);
+	printf("grid_routines_per_sec,%.0f,1/s\n", (double)grid_routines.load() / seconds);
+	printf("parallel_routines_per_sec,%.0f,1/s\n", (double)parallel_routines.load() / seconds);
+	printf("coroutine_awaits_per_sec,%.0f,1/s\n", (double)coroutine_awaits.load() / seconds);
+	printf("entities_iterated_per_sec,%.0f,1/s\n", (double)iterated / seconds);
+	printf("frames,%d,1\n", (int)frames);
+	printf("task_latency_p50,%d,us\n", (int)worker.get_latency_percentile(0, 50));
+	printf("task_latency_p99,%d,us\n", (int)worker.get_latency_percentile(0, 99));
+
+	iris_memory_stats_t allocator_stats = iris_root_allocator_t<default_block_size, default_page_size / default_block_size>::get().get_memory_stats();
+	printf("allocator_high_water,%d,bytes\n", (int)allocator_stats.high_water_bytes);
+	printf("peak_rss,%d,kb\n", (int)peak_rss_kb());
+
+	IRIS_ASSERT(frames > 0);
+	return 0;
+}
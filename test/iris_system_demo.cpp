@@ -1,4 +1,5 @@
 #include "../src/iris_system.h"
+#include "../src/iris_dispatcher.h"
 #include "../src/iris_common.inl"
 using namespace iris;
 
@@ -12,6 +13,16 @@ struct iris_component_matrix_t {
 template <typename element_t>
 using block_allocator_t = iris_block_allocator_t<element_t>;
 
+template <typename element_t>
+using tiny_vector_allocator_t = iris_inline_storage_allocator_t<element_t, 32>;
+
+// dense compile-time component ids turn cross-system checks into bitmask ANDs
+namespace iris {
+	template <> struct iris_component_id_t<uint8_t> { static constexpr size_t value = 0; };
+	template <> struct iris_component_id_t<float> { static constexpr size_t value = 1; };
+	template <> struct iris_component_id_t<iris_component_matrix_t> { static constexpr size_t value = 2; };
+}
+
 struct int_interface : iris_pool_t<int_interface, iris_queue_list_t<int*>> {
 	template <typename element_t>
 	element_t acquire_element();
@@ -31,6 +42,10 @@ inline void int_interface::release_element<int*>(int*&& object) {
 }
 
 int main(void) {
+	// request huge-page backing for root allocator blocks, falls back
+	// transparently when the system has none available
+	iris_set_huge_pages_enabled(true);
+
 	iris::iris_quota_t<int, 2> quota({ 5, 3 });
 	bool u1 = quota.acquire({ 1,2 });
 	IRIS_ASSERT(u1);
@@ -51,6 +66,28 @@ int main(void) {
 	q.push(1);
 	q.pop();
 
+	// frame-temporary scratch structures over a resettable arena
+	iris_arena_t<> arena;
+	for (size_t frame = 0; frame < 4; frame++) {
+		do {
+			iris_default_arena_allocator_t<int> scratch_allocator(arena);
+			iris_queue_list_t<int, iris_default_arena_allocator_t> scratch(scratch_allocator);
+			for (int i = 0; i < 1000; i++) {
+				scratch.push(i);
+			}
+
+			int check = 0;
+			while (!scratch.empty()) {
+				IRIS_ASSERT(scratch.top() == check++);
+				scratch.pop();
+			}
+
+			IRIS_ASSERT(check == 1000);
+		} while (false);
+
+		arena.reset(); // all pages recycled in o(1)
+	}
+
 	int_interface pool;
 	std::vector<int*> allocated;
 	for (size_t i = 0; i < 0x1234; i++) {
@@ -106,11 +143,88 @@ int main(void) {
 		}
 	});
 
+	// auto batch sizing from component sizes against a working-set budget
+	do {
+		using matrix_system_t = decltype(matrix_system);
+		static_assert(matrix_system_t::auto_batch_count<iris_component_matrix_t>() == matrix_system_t::default_batch_budget / sizeof(iris_component_matrix_t), "batch size must derive from the element size");
+		static_assert(matrix_system_t::auto_batch_count<uint8_t>() > matrix_system_t::auto_batch_count<iris_component_matrix_t>(), "small components batch larger");
+
+		size_t auto_batched = 0;
+		matrix_system.iterate_batch_auto<iris_component_matrix_t>([&auto_batched](size_t count, iris_queue_list_t<iris_component_matrix_t, block_allocator_t>::iterator it) {
+			while (count-- != 0) {
+				IRIS_ASSERT(it->values[3][3] == 2);
+				auto_batched++;
+				it++;
+			}
+		});
+
+		IRIS_ASSERT(auto_batched == matrix_system.size());
+	} while (false);
+
 	matrix_system.iterate<entity_t, iris_component_matrix_t>([](entity_t entity, iris_component_matrix_t& matrix) {
 		// initialize with identity matrix
 		IRIS_ASSERT(matrix.values[0][0] == 1);
 	});
 
+	// conflict-aware parallel system scheduling from declared access modes
+	do {
+		iris_async_worker_t<> worker(4);
+		using warp_t = iris_warp_t<iris_async_worker_t<>>;
+		using dispatcher_t = iris_dispatcher_t<warp_t>;
+		worker.start();
+
+		dispatcher_t dispatcher(worker);
+		iris_system_scheduler_t<dispatcher_t> scheduler(dispatcher);
+
+		std::atomic<int> stage;
+		stage.store(0, std::memory_order_relaxed);
+
+		// writer runs before the conflicting reader, the float pass is free to overlap
+		scheduler.attach<iris_write_t<uint8_t>>(nullptr, [&stage]() {
+			IRIS_ASSERT(stage.fetch_add(1, std::memory_order_acq_rel) >= 0);
+		});
+
+		scheduler.attach<iris_read_t<uint8_t>>(nullptr, [&stage]() {
+			IRIS_ASSERT(stage.load(std::memory_order_acquire) >= 1); // writer already done
+			stage.fetch_add(1, std::memory_order_acq_rel);
+		});
+
+		scheduler.attach<iris_write_t<float>>(nullptr, [&stage]() {
+			stage.fetch_add(1, std::memory_order_acq_rel);
+		});
+
+		IRIS_ASSERT(scheduler.size() == 3);
+		scheduler.dispatch();
+		dispatcher.wait_for_completion();
+		IRIS_ASSERT(stage.load(std::memory_order_acquire) == 3);
+
+		worker.terminate();
+		worker.finalize();
+		while (!worker.join()) {}
+	} while (false);
+
+	do {
+		iris_async_worker_t<> worker(4);
+		worker.start();
+
+		std::atomic<size_t> parallel_count;
+		parallel_count.store(0, std::memory_order_relaxed);
+		matrix_system.iterate_parallel<iris_component_matrix_t>(worker, 16, [&parallel_count](iris_component_matrix_t& matrix) {
+			IRIS_ASSERT(matrix.values[0][0] == 1);
+			matrix.values[0][1] = 3;
+			parallel_count.fetch_add(1, std::memory_order_relaxed);
+		});
+
+		IRIS_ASSERT(parallel_count.load(std::memory_order_acquire) == matrix_system.size());
+		matrix_system.iterate<iris_component_matrix_t>([](iris_component_matrix_t& matrix) {
+			IRIS_ASSERT(matrix.values[0][1] == 3);
+		});
+
+		worker.terminate();
+		worker.finalize();
+		while (!worker.join()) {}
+	} while (false);
+
 	matrix_system.filter<iris_component_matrix_t>(0, [](iris_component_matrix_t& matrix) {
 		matrix.values[1][1] = 2;
 	});
@@ -120,6 +234,211 @@ int main(void) {
 		matrix.values[1][1] = 2;
 	});
 
+	// soa-declared component: fields live in parallel lanes
+	using bone_t = iris_soa_t<float, float, float>;
+	iris_system_t<entity_t, block_allocator_t, std::allocator, bone_t> soa_system;
+	for (size_t k = 0; k < 100; k++) {
+		soa_system.insert(iris::iris_verify_cast<entity_t>(k), bone_t(1.0f, 2.0f, (float)k));
+	}
+
+	soa_system.remove(3);
+	soa_system.component<bone_t>().for_each([](float& x, float& y, float& z) {
+		x += y + z;
+	});
+
+	float lane_sum = 0;
+	for (auto&& x : soa_system.component<bone_t>().field<0>()) {
+		lane_sum += x;
+	}
+
+	soa_system.iterate<bone_t>([](std::tuple<float&, float&, float&> refs) {
+		IRIS_ASSERT(std::get<0>(refs) >= 3.0f);
+	});
+
+	soa_system.filter<bone_t>(5, [](std::tuple<float&, float&, float&> refs) {
+		IRIS_ASSERT(std::get<2>(refs) == 5.0f);
+	});
+
+	printf("soa lane sum: %f\n", lane_sum);
+	soa_system.clear();
+
+	// incremental defragmentation: removals shuffle storage order, compact
+	// restores entity order with bounded work per call
+	iris_system_t<entity_t, block_allocator_t, std::allocator, uint64_t> compact_system;
+	for (size_t k = 0; k < 64; k++) {
+		compact_system.insert(iris::iris_verify_cast<entity_t>(k), (uint64_t)k);
+	}
+
+	for (size_t k = 3; k < 40; k += 7) {
+		compact_system.remove(iris::iris_verify_cast<entity_t>(k));
+	}
+
+	while (!compact_system.compact(4)) {}
+
+	entity_t last_entity = 0;
+	compact_system.iterate<entity_t, uint64_t>([&last_entity](entity_t entity, uint64_t& value) {
+		IRIS_ASSERT(value == (uint64_t)entity);
+		IRIS_ASSERT(entity >= last_entity);
+		last_entity = entity;
+	});
+
+	// tiny sub-world: the entity index lives inline in the system object
+	do {
+		iris_system_t<entity_t, block_allocator_t, tiny_vector_allocator_t, uint16_t> tiny_system;
+		for (size_t k = 0; k < 24; k++) {
+			tiny_system.insert(iris::iris_verify_cast<entity_t>(k), (uint16_t)(k * 2));
+		}
+
+		tiny_system.remove(5);
+		IRIS_ASSERT(!tiny_system.valid(5));
+		IRIS_ASSERT(tiny_system.size() == 23);
+
+		uint16_t tiny_sum = 0;
+		tiny_system.iterate<uint16_t>([&tiny_sum](uint16_t& value) {
+			tiny_sum = (uint16_t)(tiny_sum + value);
+		});
+
+		IRIS_ASSERT(tiny_sum == (uint16_t)((23 * 24) - 10));
+
+		// growing beyond the inline capacity spills to the heap transparently
+		for (size_t k = 24; k < 64; k++) {
+			tiny_system.insert(iris::iris_verify_cast<entity_t>(k), (uint16_t)k);
+		}
+
+		IRIS_ASSERT(tiny_system.size() == 63);
+	} while (false);
+
+	// double-buffered component snapshot: readers see the last flip while the
+	// live state keeps mutating
+	do {
+		iris_component_snapshot_t<decltype(compact_system), uint64_t> snapshot(compact_system);
+		snapshot.flip();
+
+		uint64_t before = snapshot.get()[0];
+		compact_system.filter<uint64_t>(0, [](uint64_t& value) {
+			value += 1000; // simulation writes the next tick
+		});
+
+		IRIS_ASSERT(snapshot.get()[0] == before); // readers unaffected until flip
+		snapshot.flip();
+		IRIS_ASSERT(snapshot.get()[0] == before + 1000);
+
+		compact_system.filter<uint64_t>(0, [](uint64_t& value) {
+			value -= 1000;
+		});
+		snapshot.flip();
+	} while (false);
+
+	// generational handles: stale handles go invalid the moment the index recycles
+	do {
+		iris_generational_entity_allocator_t<entity_t> gen_allocator;
+		entity_t first = gen_allocator.allocate();
+		IRIS_ASSERT(gen_allocator.is_valid(first));
+
+		gen_allocator.free(first);
+		IRIS_ASSERT(!gen_allocator.is_valid(first)); // stale immediately
+
+		entity_t recycled = gen_allocator.allocate();
+		IRIS_ASSERT(gen_allocator.get_index(recycled) == gen_allocator.get_index(first));
+		IRIS_ASSERT(recycled != first); // same index, new generation
+		IRIS_ASSERT(gen_allocator.is_valid(recycled));
+		IRIS_ASSERT(!gen_allocator.is_valid(first));
+
+		// systems key by the dense index part, accesses gate on is_valid
+		iris_system_t<entity_t, block_allocator_t, std::allocator, uint64_t> handle_system;
+		handle_system.insert(gen_allocator.get_index(recycled), (uint64_t)42);
+		if (gen_allocator.is_valid(recycled)) {
+			IRIS_ASSERT(handle_system.get<uint64_t>(gen_allocator.get_index(recycled)) == 42);
+		}
+
+		IRIS_ASSERT(!gen_allocator.is_valid(first)); // the old handle never reaches the system
+	} while (false);
+
+	// one-pass sorted batch insertion
+	do {
+		iris_system_t<entity_t, block_allocator_t, std::allocator, uint64_t> bulk_system;
+		bulk_system.insert(10, (uint64_t)10);
+		bulk_system.insert(500, (uint64_t)500);
+
+		std::vector<entity_t> batch_entities;
+		std::vector<uint64_t> batch_values;
+		for (entity_t e = 100; e < 400; e += 3) {
+			batch_entities.emplace_back(e);
+			batch_values.emplace_back((uint64_t)e);
+		}
+
+		bulk_system.insert_batch(batch_entities.begin(), batch_entities.end(), batch_values.begin());
+		IRIS_ASSERT(bulk_system.size() == batch_entities.size() + 2);
+
+		for (size_t i = 0; i < batch_entities.size(); i++) {
+			IRIS_ASSERT(bulk_system.valid(batch_entities[i]));
+			IRIS_ASSERT(bulk_system.get<uint64_t>(batch_entities[i]) == (uint64_t)batch_entities[i]);
+		}
+
+		// the merged index stays sorted, so range filters keep working
+		entity_t probe[2] = { 103, 500 };
+		size_t filtered = 0;
+		bulk_system.filter<uint64_t>(&probe[0], &probe[0] + 2, [&filtered](uint64_t& value) {
+			filtered++;
+		});
+
+		IRIS_ASSERT(filtered == 2);
+		bulk_system.remove(batch_entities.begin(), batch_entities.end()); // bulk removal counterpart
+		IRIS_ASSERT(bulk_system.size() == 2);
+	} while (false);
+
+	// streaming world snapshot: node-level block copies out, bulk reload
+	do {
+		std::vector<uint8_t> snapshot;
+		compact_system.save_snapshot(snapshot);
+
+		iris_system_t<entity_t, block_allocator_t, std::allocator, uint64_t> restored;
+		bool truncated_rejected = !restored.load_snapshot(snapshot.data(), 8); // truncated input rejected
+		IRIS_ASSERT(truncated_rejected);
+
+		// a hostile entity count that would wrap the size arithmetic is rejected
+		std::vector<uint8_t> hostile(snapshot.begin(), snapshot.begin() + sizeof(decltype(restored)::snapshot_header_t));
+		uint64_t wrapping_count = ~uint64_t(0) / sizeof(entity_t) + 1;
+		std::memcpy(&hostile[16], &wrapping_count, sizeof(wrapping_count)); // entity_count field
+		bool hostile_rejected = !restored.load_snapshot(hostile.data(), hostile.size());
+		IRIS_ASSERT(hostile_rejected);
+		bool loaded = restored.load_snapshot(snapshot.data(), snapshot.size());
+		IRIS_ASSERT(loaded);
+		IRIS_ASSERT(restored.size() == compact_system.size());
+
+		compact_system.iterate<entity_t, uint64_t>([&restored](entity_t entity, uint64_t& value) {
+			IRIS_ASSERT(restored.valid(entity));
+			IRIS_ASSERT(restored.get<uint64_t>(entity) == value);
+		});
+	} while (false);
+
+	// cached view: repeated iteration over a stable entity set without lookups
+	do {
+		using view_t = iris_system_view_t<decltype(compact_system), uint64_t>;
+		view_t view(compact_system);
+		for (entity_t e = 40; e < 60; e++) {
+			view.subscribe(e);
+		}
+
+		for (size_t pass = 0; pass < 3; pass++) {
+			uint64_t view_sum = 0;
+			view.for_each([&view_sum](uint64_t& value) {
+				view_sum += value;
+			});
+
+			IRIS_ASSERT(view_sum == (40 + 59) * 20 / 2);
+		}
+
+		compact_system.remove(45); // mutation triggers a lazy refresh
+		uint64_t view_sum = 0;
+		view.for_each([&view_sum](uint64_t& value) {
+			view_sum += value;
+		});
+
+		IRIS_ASSERT(view_sum == (40 + 59) * 20 / 2 - 45);
+		IRIS_ASSERT(view.size() == 19);
+	} while (false);
+
 	iris_system_t<entity_t, block_allocator_t, std::allocator, float, uint8_t> other_system;
 	for (size_t k = 0; k < 5; k++) {
 		other_system.insert(iris::iris_verify_cast<entity_t>(k), 0.1f, (uint8_t)k);
@@ -162,6 +481,22 @@ int main(void) {
 
 	IRIS_ASSERT(counter == 0);
 	
+	// per-entity component masks: O(1) membership and batch prefiltering
+	do {
+		IRIS_ASSERT(!systems.has<uint8_t>(900));
+		systems.insert(other_system, 900, 1.5f, (uint8_t)7);
+		IRIS_ASSERT((systems.has<uint8_t, float>(900)));
+		IRIS_ASSERT(!systems.has<iris_component_matrix_t>(900));
+
+		entity_t candidates[3] = { 900, 901, 902 };
+		entity_t matched[3];
+		entity_t* matched_end = systems.select<float>(&candidates[0], &candidates[0] + 3, &matched[0]);
+		IRIS_ASSERT(matched_end - &matched[0] == 1 && matched[0] == 900);
+
+		systems.remove(900);
+		IRIS_ASSERT(!systems.has<uint8_t>(900));
+	} while (false);
+
 	iris_system_t<entity_t, block_allocator_t, std::allocator, uint8_t> re_system;
 	systems.attach(re_system);
 	re_system.insert(0, 1u);
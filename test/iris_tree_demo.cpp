@@ -1,4 +1,5 @@
 #include "../src/iris_tree.h"
+#include "../src/iris_dispatcher.h"
 #include "../src/iris_common.inl"
 #include <utility>
 #include <vector>
@@ -146,6 +147,207 @@ int main(void) {
 		root = static_cast<sample_tree*>(root->optimize());
 	}
 
+	// cache-packed node pool: nodes live contiguously, repack() rewrites the
+	// tree in bfs order for traversal locality
+	do {
+		iris_tree_pool_t<box> pool;
+		std::vector<box> keys;
+		iris_tree_pool_t<box>::tree_t* pool_root = pool.allocate(build_box_randomly(), 0);
+		keys.emplace_back(pool_root->get_key());
+
+		for (size_t i = 1; i < 1000; i++) {
+			iris_tree_pool_t<box>::tree_t* node = pool.allocate(build_box_randomly(), rand() % 6);
+			keys.emplace_back(node->get_key());
+			node->attach(pool_root);
+		}
+
+		pool_root = pool.repack(pool_root);
+		IRIS_ASSERT(pool.size() == keys.size());
+
+		// batched overlap sweep over the packed chunks must match brute force
+		for (size_t n = 0; n < 16; n++) {
+			box b = build_box_randomly();
+			size_t expected = 0;
+			for (size_t i = 0; i < keys.size(); i++) {
+				expected += overlap(keys[i], b);
+			}
+
+			size_t batched = pool.for_each_overlap(b, [](iris_tree_t<box>& tree) {});
+			IRIS_ASSERT(batched == expected);
+		}
+
+		for (size_t n = 0; n < 64; n++) {
+			box b = build_box_randomly();
+			size_t expected = 0;
+			for (size_t i = 0; i < keys.size(); i++) {
+				expected += overlap(keys[i], b);
+			}
+
+			size_t count = 0;
+			pool_root->query<true>(b, [&count, &b](const iris_tree_t<box>& tree) {
+				if (overlap(b, tree.get_key())) {
+					count++;
+				}
+
+				return true;
+			});
+
+			IRIS_ASSERT(count == expected);
+		}
+	} while (false);
+
+	// wait-free snapshot reads while a writer keeps mutating its live tree
+	do {
+		iris_tree_snapshot_t<box> snapshots;
+		std::atomic<bool> writer_done;
+		writer_done.store(false, std::memory_order_relaxed);
+
+		std::thread writer([&snapshots, &writer_done]() {
+			std::vector<iris_tree_t<box>> live;
+			live.reserve(512);
+			iris_tree_t<box>* live_root = nullptr;
+
+			for (size_t round = 0; round < 200; round++) {
+				if (live.size() < 512) {
+					live.emplace_back(iris_tree_t<box>(build_box_randomly(), rand() % 6));
+					if (live_root == nullptr) {
+						live_root = &live.back();
+					} else {
+						live.back().attach(live_root);
+					}
+				}
+
+				if ((round & 7) == 7) {
+					snapshots.publish(live_root);
+				}
+			}
+
+			writer_done.store(true, std::memory_order_release);
+		});
+
+		std::thread reader([&snapshots, &writer_done]() {
+			size_t queries = 0;
+			while (!writer_done.load(std::memory_order_acquire)) {
+				auto guard = snapshots.acquire();
+				if (guard.view() != nullptr) {
+					box b = build_box_randomly();
+					size_t count = 0;
+					guard.view()->query<true>(b, [&count, &b](const iris_tree_frozen_t<box>::node_t& node) {
+						if (overlap(b, node.get_key())) {
+							count++;
+						}
+
+						return true;
+					});
+
+					IRIS_ASSERT(count <= guard.view()->get_count());
+					queries++;
+				}
+			}
+
+			printf("snapshot reader completed %d queries\n", (int)queries);
+		});
+
+		writer.join();
+		reader.join();
+	} while (false);
+
+	// parallel rebuild over an async worker, queries must keep matching
+	do {
+		iris_async_worker_t<> worker(4);
+		worker.start();
+
+		root = static_cast<sample_tree*>(root->optimize(worker, 1024));
+
+		for (size_t n = 0; n < size_t(10 * length); n++) {
+			box b = build_box_randomly();
+			size_t search_count = linear_search(root, nodes, b);
+			size_t query_count = fast_query(root, b);
+
+			if (query_count != search_count) {
+				printf("unmatched result after parallel rebuild, %d got, %d expected.\n", (int)query_count, (int)search_count);
+				return -1;
+			}
+		}
+
+		// freeze into a flat blob and query the read-only snapshot
+		do {
+			std::vector<uint8_t> blob;
+			iris_tree_frozen_t<box>::freeze(root, blob);
+
+			iris_tree_frozen_t<box> frozen;
+			bool malformed_rejected = !frozen.attach(blob.data(), sizeof(uint32_t)); // malformed input rejected
+			IRIS_ASSERT(malformed_rejected);
+			// a hostile count that would wrap the size arithmetic is rejected
+			std::vector<uint8_t> hostile(blob.begin(), blob.begin() + sizeof(iris_tree_frozen_t<box>::header_t));
+			uint64_t wrapping_count = ~uint64_t(0) / sizeof(iris_tree_frozen_t<box>::node_t) + 1;
+			std::memcpy(&hostile[8], &wrapping_count, sizeof(wrapping_count)); // count field
+			bool hostile_rejected = !frozen.attach(hostile.data(), hostile.size());
+			IRIS_ASSERT(hostile_rejected);
+
+			bool attached = frozen.attach(blob.data(), blob.size());
+			IRIS_ASSERT(attached);
+			IRIS_ASSERT(frozen.get_count() != 0); // queries below run against real data
+
+			for (size_t n = 0; n < 32; n++) {
+				box b = build_box_randomly();
+				size_t expected = fast_query(root, b);
+
+				size_t count = 0;
+				frozen.query<true>(b, [&count, &b](const iris_tree_frozen_t<box>::node_t& node) {
+					if (overlap(b, node.get_key())) {
+						count++;
+					}
+
+					return true;
+				});
+
+				IRIS_ASSERT(count == expected);
+			}
+		} while (false);
+
+		// batched queries, serial and parallel, must match per-key queries
+		do {
+			std::vector<box> query_keys;
+			for (size_t n = 0; n < 256; n++) {
+				query_keys.emplace_back(build_box_randomly());
+			}
+
+			std::atomic<size_t> batch_count;
+			batch_count.store(0, std::memory_order_relaxed);
+			size_t single_count = 0;
+
+			for (size_t n = 0; n < query_keys.size(); n++) {
+				single_count += fast_query(root, query_keys[n]);
+			}
+
+			root->query_batch<true>(query_keys.begin(), query_keys.end(), [&batch_count](const box& key, const sample_tree::base& tree) {
+				if (overlap(key, tree.get_key())) {
+					batch_count.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				return true;
+			});
+
+			IRIS_ASSERT(batch_count.load(std::memory_order_acquire) == single_count);
+
+			batch_count.store(0, std::memory_order_relaxed);
+			root->query_batch<true>(query_keys.begin(), query_keys.end(), [&batch_count](const box& key, const sample_tree::base& tree) {
+				if (overlap(key, tree.get_key())) {
+					batch_count.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				return true;
+			}, worker);
+
+			IRIS_ASSERT(batch_count.load(std::memory_order_acquire) == single_count);
+		} while (false);
+
+		worker.terminate();
+		worker.finalize();
+		while (!worker.join()) {}
+	} while (false);
+
 	return 0;
 }
 
@@ -17,6 +17,7 @@ namespace iris {
 		lua.set_current<&lua_co_await_t::start>("start");
 		lua.set_current<&lua_co_await_t::terminate>("terminate");
 		lua.set_current<&lua_co_await_t::poll>("poll");
+		lua.set_current<&lua_co_await_t::parallel_map>("parallel_map");
 		lua.set_current<&lua_co_await_t::tutorial_binding>("tutorial_binding");
 		lua.set_current<&lua_co_await_t::tutorial_async>("tutorial_async");
 		lua.set_current<&lua_co_await_t::tutorial_warp>("tutorial_warp");
@@ -103,6 +104,51 @@ namespace iris {
 		}
 	}
 
+	lua_coroutine_t<lua_ref_t> lua_co_await_t::parallel_map(lua_t&& lua, lua_ref_t&& items) {
+		IRIS_ASSERT(async_worker != nullptr);
+
+		// the reference parameters die at the first suspension, keep a copy of
+		// the state handle in the coroutine frame
+		lua_t script_lua = lua;
+
+		// snapshot the descriptors while still on the script warp
+		std::vector<double> inputs = items.as<std::vector<double>>(script_lua);
+		script_lua.deref(std::move(items));
+
+		// leave the script warp while the jobs run across the pool
+		lua_warp_t* current = co_await iris_switch(static_cast<lua_warp_t*>(nullptr));
+
+		std::vector<double> results(inputs.size());
+		iris_event_t<lua_warp_t> completed(*async_worker);
+		std::atomic<size_t> remaining;
+		remaining.store(inputs.size(), std::memory_order_relaxed);
+
+		for (size_t i = 0; i < inputs.size(); i++) {
+			async_worker->queue([&results, &inputs, &remaining, &completed, i]() {
+				// the per-item native work, squaring stands in for the real job
+				results[i] = inputs[i] * inputs[i];
+
+				if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					completed.notify();
+				}
+			});
+		}
+
+		if (inputs.empty()) {
+			completed.notify();
+		}
+
+		co_await completed;
+
+		// gather results back on the original warp, one resume for the whole batch
+		co_await iris_switch(current);
+		co_return script_lua.make_table([&results](lua_t lua) {
+			for (size_t i = 0; i < results.size(); i++) {
+				lua.set_current(iris_verify_cast<int>(i + 1), results[i]);
+			}
+		});
+	}
+
 	// tutorials
 	lua_ref_t lua_co_await_t::tutorial_binding(lua_t&& lua) {
 		return lua.make_type<tutorial_binding_t>("tutorial_binding");
@@ -158,7 +204,13 @@ coroutine.wrap(function () \n\
 	print('complete readwrite') \n\
 	complete_count = complete_count + 1 \n\
 end)() \n\
-while complete_count < 4 do \n\
+coroutine.wrap(function () \n\
+	local results = co_await:parallel_map({ 1, 2, 3, 4, 5 }) \n\
+	assert(#results == 5 and results[3] == 9) \n\
+	print('complete parallel_map') \n\
+	complete_count = complete_count + 1 \n\
+end)() \n\
+while complete_count < 5 do \n\
 	co_await:poll(1000) \n\
 end \n\
 co_await:terminate() \n\
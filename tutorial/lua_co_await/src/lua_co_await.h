@@ -18,6 +18,10 @@ namespace iris {
 		bool terminate() noexcept;
 		bool poll(size_t delayInMilliseonds);
 
+		// fan a table of work descriptors out across the pool in parallel and
+		// resume the calling lua coroutine once with the gathered results
+		lua_coroutine_t<lua_ref_t> parallel_map(lua_t&& lua, lua_ref_t&& items);
+
 		// examples
 		lua_ref_t tutorial_binding(lua_t&& lua);
 		lua_ref_t tutorial_async(lua_t&& lua);